@@ -0,0 +1,23 @@
+#pragma once
+
+#include "AuxKernel.h"
+
+class ColumnSurfaceEvolution;
+
+/**
+ * Vertical mesh displacement of the column-wise stretch following the surface elevation (see
+ * ColumnSurfaceEvolution)
+ */
+class ColumnStretchAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  ColumnStretchAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  /// Column-wise surface evolution
+  const ColumnSurfaceEvolution & _evolution;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ADIntegratedBC.h"
+
+/**
+ * Basal traction beta * u for one velocity component of the first-order (Blatter-Pattyn) model,
+ * using the sliding laws of the equivalent sediment layer (see BasalFriction.h)
+ */
+class ADBasalFrictionBC : public ADIntegratedBC
+{
+public:
+  static InputParameters validParams();
+
+  ADBasalFrictionBC(const InputParameters & parameters);
+
+protected:
+  ADReal computeQpResidual() override;
+
+  // Sediment sliding law
+  const bool _drucker_prager;
+
+  // Slip model
+  const Real & _SlipperinessCoefficient;
+  const Real & _LayerThickness;
+
+  // DruckerPrager model
+  const Real & _FrictionCoefficient;
+  const Real & _II_eps_min;
+
+  // velocity (sliding speed of the DruckerPrager model)
+  const ADVariableValue & _vel_x;
+  const ADVariableValue & _vel_y;
+
+  // pressure, or hydrostatic pressure below the surface elevation (DruckerPrager model)
+  const ADVariableValue & _p;
+  const ADVariableValue & _surface;
+  const bool _hydrostatic;
+
+  // ice density and gravity acceleration
+  const Real & _rho;
+  const Real & _g;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "ADIntegratedBC.h"
+#include "MooseEnum.h"
+
+/**
+ * Ocean pressure at a calving front for one horizontal velocity component of the first-order
+ * (Blatter-Pattyn) model: the front carries the difference between the hydrostatic ice pressure
+ * below the surface elevation and the hydrostatic water pressure below the water level
+ */
+class BlatterPattynOceanPressureBC : public ADIntegratedBC
+{
+public:
+  static InputParameters validParams();
+
+  BlatterPattynOceanPressureBC(const InputParameters & parameters);
+
+protected:
+  ADReal computeQpResidual() override;
+
+  /// Horizontal velocity component (x=0, y=1) of this boundary condition
+  const unsigned int _component;
+
+  /// Vertical direction (the last mesh direction)
+  const unsigned int _vertical;
+
+  /// Surface elevation
+  const ADVariableValue & _surface;
+
+  const Real & _rho;
+  const Real & _water_density;
+  const Real & _g;
+  const Real & _water_level;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ADVectorIntegratedBC.h"
+
+/**
+ * Basal traction -beta * u_t equivalent to an extruded sediment layer (see BasalFriction.h), applied
+ * on the ice base instead of meshing the layer. Only the tangential velocity u_t = u - (u.n) n is
+ * resisted, the flow through the bed being left to a separate (no-penetration) condition.
+ */
+class INSADBasalFrictionBC : public ADVectorIntegratedBC
+{
+public:
+  static InputParameters validParams();
+
+  INSADBasalFrictionBC(const InputParameters & parameters);
+
+protected:
+  ADReal computeQpResidual() override;
+
+  // Sediment sliding law
+  const bool _drucker_prager;
+
+  // Slip model
+  const Real & _SlipperinessCoefficient;
+  const Real & _LayerThickness;
+
+  // DruckerPrager model
+  const Real & _FrictionCoefficient;
+  const Real & _II_eps_min;
+
+  // pressure (DruckerPrager model)
+  const ADVariableValue & _p;
+};
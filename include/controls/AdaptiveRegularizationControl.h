@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Control.h"
+#include "Restartable.h"
+
+/**
+ * Continuation control of a viscosity regularization parameter (e.g. 'rampedup_viscosity' or
+ * 'II_eps_min') driven by the nonlinear convergence history.
+ *
+ * The parameter is advanced in log space towards its target value at each time step. The step
+ * grows when Newton converges in a few iterations, shrinks when it struggles, and the parameter is
+ * brought back closer to the last converged value when a solve fails. The continuation state is
+ * restartable, so a recovered run resumes where it stopped.
+ */
+class AdaptiveRegularizationControl : public Control, public Restartable
+{
+public:
+  static InputParameters validParams();
+
+  AdaptiveRegularizationControl(const InputParameters & parameters);
+
+  virtual void execute() override;
+
+protected:
+  /// Next value of the parameter, a log step away from the last converged value
+  Real advance() const;
+
+  /// Regularization value at the start of the continuation
+  const Real _initial_value;
+
+  /// Regularization value at the end of the continuation
+  const Real _target_value;
+
+  /// Step bounds in decades
+  const Real _min_log_step;
+  const Real _max_log_step;
+
+  /// Step multipliers after an easy solve and after a failed or slow solve
+  const Real _growth_factor;
+  const Real _cutback_factor;
+
+  /// Iteration counts below (above) which the step grows (shrinks)
+  const unsigned int _fast_iterations;
+  const unsigned int _slow_iterations;
+
+  /// Number of nonlinear iterations of the last solve
+  const PostprocessorValue & _nl_its;
+
+  /// Current step in decades
+  Real & _log_step;
+
+  /// Value of the parameter for the current solve
+  Real & _current_value;
+
+  /// Value of the parameter for the last converged solve
+  Real & _converged_value;
+
+  /// Whether the parameter has been set once
+  bool & _initialized;
+
+  /// Whether a solve has converged since the start of the continuation
+  bool & _converged_once;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Transient.h"
+
+/**
+ * Pseudo-transient run to steady state on a sequence of meshes, from coarse to fine.
+ *
+ * Each time the steady state is detected on a coarse level, the mesh is refined (uniformly or in
+ * the given blocks), the solution is projected on the refined mesh and the time integration goes
+ * on. The time, and with it the time step and every continuation parameter driven by controls, is
+ * carried over to the next level. Coarse levels use loose tolerances, only the last level uses
+ * the tolerances of the executioner.
+ */
+class GridSequencedTransient : public Transient
+{
+public:
+  static InputParameters validParams();
+
+  GridSequencedTransient(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual bool keepGoing() override;
+
+protected:
+  /// Refine the mesh for the next level and project the solution on it
+  void refine();
+
+  /// Set the tolerances of the current level
+  void setLevelTolerances();
+
+  /// Number of mesh levels, including the initial mesh
+  const unsigned int _num_levels;
+
+  /// Blocks refined between two levels (uniform refinement if empty)
+  std::vector<SubdomainName> _refine_blocks;
+
+  /// Tolerances of the coarse levels
+  const Real _coarse_nl_rel_tol;
+  const Real _coarse_nl_abs_tol;
+  const Real _coarse_steady_state_tolerance;
+
+  /// Tolerances of the last level
+  const Real _fine_nl_rel_tol;
+  const Real _fine_nl_abs_tol;
+  const Real _fine_steady_state_tolerance;
+
+  /// Current level, restartable so that a recovered run resumes on the right level
+  unsigned int & _level;
+};
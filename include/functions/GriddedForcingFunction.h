@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Function.h"
+
+class GriddedForcingData;
+
+/**
+ * Function (and functor) view of a memory-mapped gridded forcing field
+ */
+class GriddedForcingFunction : public Function
+{
+public:
+  static InputParameters validParams();
+
+  GriddedForcingFunction(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual Real value(Real t, const Point & p) const override;
+
+protected:
+  /// Gridded data, retrieved at initial setup since user objects are built after functions
+  const GriddedForcingData * _data;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Function.h"
+
+class ShallowIceWarmStart;
+
+/**
+ * Function view of the shallow-ice warm start (one velocity component or the pressure), to be used
+ * with the function initial conditions of the FE and FV variables
+ */
+class ShallowIceWarmStartFunction : public Function
+{
+public:
+  static InputParameters validParams();
+
+  ShallowIceWarmStartFunction(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual Real value(Real t, const Point & p) const override;
+  virtual RealVectorValue vectorValue(Real t, const Point & p) const override;
+
+protected:
+  /// Velocity component (0, 1, 2) or pressure (3)
+  const unsigned int _field;
+
+  /// Warm start, retrieved at initial setup since user objects are built after functions
+  const ShallowIceWarmStart * _warm_start;
+};
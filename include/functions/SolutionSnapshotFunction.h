@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Function.h"
+
+class SolutionSnapshot;
+
+/**
+ * Function view of a field of a solution snapshot, to be used with the function initial
+ * conditions of the FE and FV variables
+ */
+class SolutionSnapshotFunction : public Function
+{
+public:
+  static InputParameters validParams();
+
+  SolutionSnapshotFunction(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual Real value(Real t, const Point & p) const override;
+  virtual RealVectorValue vectorValue(Real t, const Point & p) const override;
+
+protected:
+  /// Snapshot, retrieved at initial setup since user objects are built after functions
+  const SolutionSnapshot * _snapshot;
+
+  /// Index of the field (scalar variables)
+  int _field;
+
+  /// Indices of the component fields (vector variables), -1 if absent
+  int _components[3];
+};
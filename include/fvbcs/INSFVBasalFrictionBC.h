@@ -0,0 +1,40 @@
+#pragma once
+
+#include "INSFVNaturalFreeSlipBC.h"
+
+/**
+ * Basal traction -beta * u_t equivalent to an extruded sediment layer (see BasalFriction.h), applied
+ * on the ice base instead of meshing the layer. Only the tangential velocity u_t = u - (u.n) n is
+ * resisted, the flow through the bed being left to a separate (no-penetration) condition. The
+ * friction is implicit in the velocity of the boundary cell and contributes to its Rhie-Chow 'a'
+ * coefficient.
+ */
+class INSFVBasalFrictionBC : public INSFVNaturalFreeSlipBC
+{
+public:
+  static InputParameters validParams();
+  INSFVBasalFrictionBC(const InputParameters & params);
+
+  using INSFVNaturalFreeSlipBC::gatherRCData;
+  void gatherRCData(const FaceInfo & fi) override;
+
+protected:
+  // velocity
+  const Moose::Functor<ADReal> & _vel_x;
+  const Moose::Functor<ADReal> * const _vel_y;
+  const Moose::Functor<ADReal> * const _vel_z;
+
+  // pressure (DruckerPrager model)
+  const Moose::Functor<ADReal> * const _pressure;
+
+  // Sediment sliding law
+  const bool _drucker_prager;
+
+  // Slip model
+  const Real & _SlipperinessCoefficient;
+  const Real & _LayerThickness;
+
+  // DruckerPrager model
+  const Real & _FrictionCoefficient;
+  const Real & _II_eps_min;
+};
@@ -9,22 +9,27 @@
 
 #pragma once
 
-#include "INSFVFluxBC.h"
-#include "INSFVFreeSurfaceBC.h"
+#include "INSFVNaturalFreeSlipBC.h"
 
 /**
  * A class that imparts a stress on the momentum equation
  */
-class INSFVHydrostaticPressureBC : public INSFVFreeSurfaceBC
+class INSFVHydrostaticPressureBC : public INSFVNaturalFreeSlipBC
 {
 public:
   static InputParameters validParams();
   INSFVHydrostaticPressureBC(const InputParameters & params);
 
-  using INSFVFluxBC::gatherRCData;
+  using INSFVNaturalFreeSlipBC::gatherRCData;
   void gatherRCData(const FaceInfo & fi) override;
 
 protected:
   // stress to be applied
   const Real & _water_density;
+
+  /// Elevation with respect to the sea level (vertical coordinate if null)
+  const Moose::Functor<ADReal> * const _elevation;
+
+  /// Vertical coordinate of the mesh
+  const unsigned int _vertical;
 };
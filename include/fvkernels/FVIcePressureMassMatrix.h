@@ -0,0 +1,21 @@
+#pragma once
+
+#include "FVElementalKernel.h"
+
+/**
+ * Finite volume pressure mass matrix scaled by -1/mu (cell volume / mu on the diagonal), assembled
+ * into a separate tagged matrix only. See IcePressureMassMatrix.
+ */
+class FVIcePressureMassMatrix : public FVElementalKernel
+{
+public:
+  static InputParameters validParams();
+
+  FVIcePressureMassMatrix(const InputParameters & parameters);
+
+protected:
+  ADReal computeQpResidual() override;
+
+  /// Viscosity weighting the mass matrix (mu_ice or mu_sediment)
+  const Moose::Functor<ADReal> & _mu;
+};
@@ -32,12 +32,12 @@ protected:
   /// index x|y|z
   const unsigned int _axis_index;
 
-  /// x-related stresses
-  const Moose::Functor<ADRealVectorValue> & _sig_x;
+  /// stresses related to the momentum component of this kernel (sig_x, sig_y or sig_z)
+  const Moose::Functor<ADRealVectorValue> & _sig;
 
-  /// y-related stresses
-  const Moose::Functor<ADRealVectorValue> & _sig_y;
+  /// Whether the viscous face coefficients are added to the Rhie-Chow 'a' coefficients
+  const bool _add_rc_coefficients;
 
-  /// z-related stresses
-  const Moose::Functor<ADRealVectorValue> & _sig_z;
+  /// Viscosity giving the viscous Rhie-Chow 'a' coefficients
+  const Moose::Functor<ADReal> & _mu;
 };
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Indicator.h"
+
+/**
+ * Largest jump, in decades, of the ice viscosity and of the effective strain rate between an
+ * element and its face neighbors.
+ *
+ * Both fields are evaluated as functors at the element centroids, so the indicator works for the
+ * FV ice material (functor properties) and the FE one (viscosity through an elemental auxiliary
+ * variable). The effective strain rate is computed from the velocity gradients, it differs from
+ * the viscosity jump where the viscosity is bounded (regularization, rampedup_viscosity). The
+ * indicator should be restricted to the ice blocks, the neighbors outside of its blocks are
+ * skipped.
+ */
+class ViscosityJumpIndicator : public Indicator
+{
+public:
+  static InputParameters validParams();
+
+  ViscosityJumpIndicator(const InputParameters & parameters);
+
+  virtual void computeIndicator() override;
+
+protected:
+  /// log10 of the viscosity and of the effective strain rate of an element
+  std::pair<Real, Real> logFields(const Elem * elem) const;
+
+  /// Indicator field
+  MooseVariable & _field_var;
+
+  /// Current element
+  const Elem * const & _current_elem;
+
+  /// Ice viscosity
+  const Moose::Functor<ADReal> & _mu;
+
+  /// Velocity components (strain rate jump disabled without velocity_x)
+  const Moose::Functor<ADReal> * const _vel_x;
+  const Moose::Functor<ADReal> * const _vel_y;
+  const Moose::Functor<ADReal> * const _vel_z;
+
+  /// Weight of the strain rate jump
+  const Real _strain_rate_weight;
+
+  /// Lower bound of the effective strain rate (s-1), avoids log(0) in stagnant ice
+  const Real _strain_rate_floor;
+
+  /// Lower bound of the viscosity (Pa s), avoids log(0) where the viscosity is not defined
+  const Real _viscosity_floor;
+};
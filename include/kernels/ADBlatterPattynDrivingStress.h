@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * First-order (Blatter-Pattyn) gravitational driving stress rho g grad_i(s) test for one horizontal
+ * velocity component, the pressure being hydrostatic below the surface elevation s
+ */
+class ADBlatterPattynDrivingStress : public ADKernel
+{
+public:
+  static InputParameters validParams();
+
+  ADBlatterPattynDrivingStress(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  /// Horizontal velocity component (x=0, y=1) of this kernel
+  const unsigned int _component;
+
+  /// Surface elevation gradient
+  const ADVariableGradient & _grad_surface;
+
+  // ice density and gravity acceleration
+  const Real & _rho;
+  const Real & _g;
+};
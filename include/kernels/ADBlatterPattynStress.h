@@ -0,0 +1,31 @@
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * First-order (Blatter-Pattyn) resistive stress R_ij grad_j(test) for one horizontal velocity
+ * component, with R_ij = sig_ij_dev - delta_ij sig_vv_dev built from the deviatoric stresses of
+ * ADIceMaterialSI_ru (first_order = true). The last mesh direction is vertical.
+ */
+class ADBlatterPattynStress : public ADKernel
+{
+public:
+  static InputParameters validParams();
+
+  ADBlatterPattynStress(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  /// Horizontal velocity component (x=0, y=1) of this kernel
+  const unsigned int _component;
+
+  /// Vertical direction (the last mesh direction)
+  const unsigned int _vertical;
+
+  /// Row of the deviatoric stress tensor of this component
+  std::vector<const ADMaterialProperty<Real> *> _sig_row;
+
+  /// Vertical normal deviatoric stress
+  const ADMaterialProperty<Real> & _sig_vv;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * AD counterpart of IceStressDivergence: viscous ice stress 2 * mu * eps(u) : grad(test) for one
+ * velocity component.
+ */
+class ADIceStressDivergence : public ADKernel
+{
+public:
+  static InputParameters validParams();
+
+  ADIceStressDivergence(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  /// Velocity component (x=0, y=1, z=2) of this kernel
+  const unsigned int _component;
+
+  /// Velocity gradients
+  std::vector<const ADVariableGradient *> _grad_vel;
+
+  /// Viscosity
+  const ADMaterialProperty<Real> & _mu;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * Kinematic condition ds/dt + u_h . grad(s) - w = a for the surface elevation s on a
+ * lower-dimensional surface block, stabilized with SUPG (streamline upwind test functions
+ * test + tau u_h . grad(test), tau = h / (2 |u_h|))
+ */
+class ADSurfaceKinematic : public ADKernel
+{
+public:
+  static InputParameters validParams();
+
+  ADSurfaceKinematic(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  /// Vertical direction (the last mesh direction)
+  const unsigned int _vertical;
+
+  /// Time derivative of the surface elevation
+  const ADVariableValue & _u_dot;
+
+  // velocity
+  const ADVariableValue & _vel_x;
+  const ADVariableValue & _vel_y;
+  const ADVariableValue & _vel_z;
+
+  /// Surface mass balance (m s-1 of ice)
+  const Real & _accumulation;
+
+  /// Whether the SUPG stabilization is applied
+  const bool _stabilization;
+};
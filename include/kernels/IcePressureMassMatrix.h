@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Kernel.h"
+
+/**
+ * Pressure mass matrix scaled by -1/mu, assembled into a separate tagged matrix only
+ * (extra_matrix_tags, 'pressure_mass' by default). The residual and the system matrix are left
+ * untouched.
+ *
+ * -M_p/mu is the spectrally equivalent approximation of the Schur complement of
+ * variable-viscosity Stokes problems, handed to the Schur field split by
+ * PressureMassSchurPreconditioner.
+ */
+class IcePressureMassMatrix : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  IcePressureMassMatrix(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  /// Viscosity weighting the mass matrix (mu_ice or mu_sediment)
+  const ADMaterialProperty<Real> & _mu;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Kernel.h"
+
+/**
+ * Viscous ice stress 2 * mu * eps(u) : grad(test) for one velocity component, with the exact
+ * Jacobian of Glen's law (including the strain rate dependence of the viscosity) coded by hand.
+ */
+class IceStressDivergence : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  IceStressDivergence(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Row of the strain rate tensor for a velocity component at the current quadrature point
+  RealVectorValue strainRateRow(unsigned int i) const;
+
+  /// Jacobian of the residual with respect to velocity component k
+  Real computeQpVelocityJacobian(unsigned int k) const;
+
+  /// Velocity component (x=0, y=1, z=2) of this kernel
+  const unsigned int _component;
+
+  /// Velocity gradients
+  std::vector<const VariableGradient *> _grad_vel;
+
+  /// Velocity variable numbers (invalid_uint for components not coupled)
+  std::vector<unsigned int> _vel_var;
+
+  /// Viscosity and its derivative with respect to the second invariant of the strain rate
+  const MaterialProperty<Real> & _mu;
+  const MaterialProperty<Real> & _dmu_dII_eps;
+};
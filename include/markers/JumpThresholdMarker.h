@@ -0,0 +1,25 @@
+#pragma once
+
+#include "IndicatorMarker.h"
+
+/**
+ * Refines the elements whose jump indicator (e.g. ViscosityJumpIndicator, in decades) exceeds a
+ * threshold and coarsens those below another one. Unlike an error fraction, the thresholds keep
+ * their meaning as the flow develops, so the slow interior is coarsened at every adaptivity step.
+ */
+class JumpThresholdMarker : public IndicatorMarker
+{
+public:
+  static InputParameters validParams();
+
+  JumpThresholdMarker(const InputParameters & parameters);
+
+protected:
+  virtual MarkerValue computeElementMarker() override;
+
+  /// Jump above which the elements are refined
+  const Real _refine;
+
+  /// Jump below which the elements are coarsened
+  const Real _coarsen;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ADMaterial.h"
+#include "GlenRheology.h"
 
 /**
  * Material objects inherit from Material and override computeQpProperties.
@@ -15,15 +16,44 @@ public:
 
   ADIceMaterialSI_ru(const InputParameters & parameters);
 
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
 protected:
+  /// Switch from Picard to Newton once the nonlinear residual is small enough
+  void updateNonlinearMode();
+
   /// Necessary override. This is where the values of the properties are computed.
   virtual void computeQpProperties() override;
+
+  /// Quadrature point properties specialized on the Glen exponent and the mesh dimension
+  template <unsigned int N, unsigned int DIM>
+  void computeQpPropertiesTempl();
+
+  /// Element-batched evaluation of the properties at all the quadrature points (residual-only
+  /// evaluations, the Jacobian ones go through Material::computeProperties)
+  virtual void computeProperties() override;
+  template <unsigned int N, unsigned int DIM>
+  void computePropertiesBatchedTempl();
+
+  /// Strain rates at the current quadrature point, out-of-plane components are zero in 2D
+  template <unsigned int DIM>
+  void computeQpStrainRates();
+
+  /// Bound the viscosity and compute the density and deviatoric stresses from the strain rates
+  void computeQpBoundedViscosityAndStresses();
+
   const unsigned int _mesh_dimension;
 
   // Glen parameters
   const ADReal & _AGlen;
   const ADReal & _nGlen;
 
+  // Glen constants precomputed for the specialized rheology kernels
+  const GlenRheology::Constants _glen_constants;
+  const unsigned int _glen_exponent_tag;
+
   // density of the fluid
   const ADReal & _rho;
 
@@ -37,16 +67,53 @@ protected:
 
   const ADVariableValue & _pressure;
 
+  /// Nonlinear residual norm driving the Picard to Newton switch (Picard disabled if null)
+  const PostprocessorValue * const _picard_residual;
+
+  /// Residual norm below which the viscosity derivatives are switched back on
+  const Real _newton_switch_tolerance;
+
+  /// Whether the full Newton Jacobian is used in the current time step
+  bool _newton_active;
+
+  /// Residual postprocessor value at the start of the time step (previous step's residual)
+  Real _stale_picard_residual;
+
+  /// Whether the residual postprocessor has been evaluated in the current time step
+  bool _picard_residual_updated;
+
+  /// Number of Picard Jacobian evaluations in the current time step
+  unsigned int _n_picard_jacobians;
+
+  /// Whether the strain rates follow the first-order (Blatter-Pattyn) approximation
+  const bool _first_order;
+
+  /// Whether to evaluate the value part of Glen's law for all the element quadrature points at once
+  const bool _batched_evaluation;
+
+  /// Strain rate values of the element quadrature points (structure of arrays)
+  GlenRheology::StrainRateBatch _strain_rate_batch;
+
+  /// Strain rates at the current quadrature point
+  ADReal _eps_xx;
+  ADReal _eps_yy;
+  ADReal _eps_zz;
+  ADReal _eps_xy;
+  ADReal _eps_xz;
+  ADReal _eps_yz;
+
   /// viscosity of the fluid (mu)
   ADMaterialProperty<Real> & _viscosity;
   /// density of the fluid (rho)
   ADMaterialProperty<Real> & _density;
 
-  // all components of the deviatoric stress tensor
-  ADMaterialProperty<Real> & _sig_xx_dev;
-  ADMaterialProperty<Real> & _sig_yy_dev;
-  ADMaterialProperty<Real> & _sig_zz_dev;
-  ADMaterialProperty<Real> & _sig_xy_dev;
-  ADMaterialProperty<Real> & _sig_xz_dev;
-  ADMaterialProperty<Real> & _sig_yz_dev;
+  /// Whether the deviatoric stresses are non-AD properties only computed outside of the solve
+  const bool _output_only_stresses;
+
+  /// Whether the output-only stresses are computed in the current evaluation
+  bool _compute_output_stresses;
+
+  // all components of the deviatoric stress tensor (xx, yy, zz, xy, xz, yz), AD or output-only
+  std::vector<ADMaterialProperty<Real> *> _ad_sig_dev;
+  std::vector<MaterialProperty<Real> *> _sig_dev;
 };
@@ -2,6 +2,13 @@
 
 #include "ADMaterial.h"
 
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+class GriddedForcingData;
+
 /**
  * Material objects inherit from Material and override computeQpProperties.
  *
@@ -15,9 +22,39 @@ public:
 
   ADSedimentMaterialSI(const InputParameters & parameters);
 
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void meshChanged() override;
+
+  /// Time-independent fields of an element (or element side for boundary materials)
+  struct SpatialFields
+  {
+    /// viscosity without flood at each quadrature point (unused for time-dependent data)
+    std::vector<Real> base_viscosity;
+
+    /// flood amplitude at each quadrature point, zero outside of the flood path (one inside of
+    /// it for time-dependent data)
+    std::vector<Real> flood_amplitude;
+
+    /// time for the flood peak to travel from the start position to the element
+    Real flood_delay;
+  };
+
 protected:
+  /// Look up the cached spatial fields and evaluate the flood time factor once per element
+  virtual void computeProperties() override;
+
   /// Necessary override. This is where the values of the properties are computed.
   virtual void computeQpProperties() override;
+
+  /// Compute the spatial fields of the current element at the current quadrature points
+  void computeSpatialFields(SpatialFields & fields) const;
+
+  /// Parameters the spatial fields depend on (they are controllable)
+  std::tuple<bool, Real, Real, Real> spatialParameters() const;
+
+  /// Drop the cached spatial fields if the parameters they depend on changed
+  void checkSpatialParameters();
   const unsigned int _mesh_dimension;
 
   // density of the fluid
@@ -40,6 +77,30 @@ protected:
   const Real & _FloodSpreadTime;
   const Real & _FloodSpeed;
 
+  /// Gridded sediment viscosity and flood amplitude (built-in fields if null)
+  const GriddedForcingData * const _base_viscosity_data;
+  const GriddedForcingData * const _flood_amplitude_data;
+
+  /// Whether the gridded fields have a time dimension (they are then interpolated at every qp)
+  const bool _base_viscosity_time_dependent;
+  const bool _flood_amplitude_time_dependent;
+
+  /// Whether to cache the spatial fields per element
+  const bool _cache_spatial_fields;
+
+  /// Spatial fields keyed on (element, side), the side being invalid for element materials
+  std::map<std::pair<const Elem *, unsigned int>, SpatialFields> _spatial_fields_cache;
+
+  /// Parameters the cached spatial fields were computed with
+  std::tuple<bool, Real, Real, Real> _cached_spatial_parameters;
+
+  /// Spatial fields of the current element
+  SpatialFields _current_fields;
+  const SpatialFields * _fields;
+
+  /// Gaussian-in-time flood factor of the current element
+  Real _flood_factor;
+
   /// viscosity of the fluid (mu)
   ADMaterialProperty<Real> & _viscosity;
   /// density of the fluid (rho)
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "FunctorMaterial.h"
+#include "GlenRheology.h"
+
+#include <optional>
+#include <tuple>
 
 /**
  * Material objects inherit from Material and override computeQpProperties.
@@ -15,13 +19,61 @@ public:
 
   FVIceMaterialSI(const InputParameters & parameters);
 
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
+  /// Strain rate state shared by all the functor properties at one functor argument
+  struct StrainRate
+  {
+    // velocity gradients (rows of the velocity gradient tensor)
+    ADRealVectorValue grad_x;
+    ADRealVectorValue grad_y;
+    ADRealVectorValue grad_z;
+
+    // off-diagonal strain rates
+    ADReal eps_xy;
+    ADReal eps_xz;
+    ADReal eps_yz;
+
+    // second invariant of the strain rate tensor
+    ADReal II_eps;
+
+    // Glen viscosity
+    ADReal mu;
+  };
+
 protected:
+  /// Compute the velocity gradients, strain rates, invariant and viscosity at a functor argument
+  template <typename Space>
+  StrainRate computeStrainRate(const Space & r, const Moose::StateArg & t);
+
+  /// Strain rate state specialized on the Glen exponent and the mesh dimension
+  template <unsigned int N, unsigned int DIM, typename Space>
+  StrainRate computeStrainRateTempl(const Space & r, const Moose::StateArg & t);
+
+  /// Strain rate state at a functor argument, the last face and element arguments being cached
+  template <typename Space>
+  StrainRate strainRate(const Space & r, const Moose::StateArg & t);
+  const StrainRate & strainRate(const Moose::FaceArg & r, const Moose::StateArg & t);
+  const StrainRate & strainRate(const Moose::ElemArg & r, const Moose::StateArg & t);
+
+  /// Drop the cached strain rate states
+  void clearStrainRateCache();
+
+  /// Switch from Picard to Newton once the nonlinear residual is small enough
+  void updateNonlinearMode();
+
   const unsigned int _mesh_dimension;
 
   // Glen parameters
   const Real _AGlen;
   const Real _nGlen;
 
+  // Glen constants precomputed for the specialized rheology kernels
+  const GlenRheology::Constants _glen_constants;
+  const unsigned int _glen_exponent_tag;
+
   // density of the fluid
   const Real & _rho;
 
@@ -35,4 +87,43 @@ protected:
 
   // Finite strain rate parameter
   const Real & _II_eps_min;
+
+  /// Nonlinear residual norm driving the Picard to Newton switch (Picard disabled if null)
+  const PostprocessorValue * const _picard_residual;
+
+  /// Residual norm below which the viscosity derivatives are switched back on
+  const Real _newton_switch_tolerance;
+
+  /// Whether the full Newton Jacobian is used in the current time step
+  bool _newton_active;
+
+  /// Residual postprocessor value at the start of the time step (previous step's residual)
+  Real _stale_picard_residual;
+
+  /// Whether the residual postprocessor has been evaluated in the current time step
+  bool _picard_residual_updated;
+
+  /// Number of Picard Jacobian evaluations in the current time step
+  unsigned int _n_picard_jacobians;
+
+  /// Whether to print the strain rate cache statistics at each time step
+  const bool _output_cache_statistics;
+
+  /// Key of the last face strain rate state (face, face side, skewness correction, state,
+  /// iteration type). The sibling momentum kernels query the same face one after the other, so
+  /// a single entry (per thread, each thread owning its material copy) keeps all the reuse.
+  std::optional<std::tuple<const FaceInfo *, const Elem *, bool, unsigned int, unsigned int>>
+      _face_strain_rate_key;
+  StrainRate _face_strain_rate;
+
+  /// Key of the last element strain rate state (element, skewness correction, state, iteration
+  /// type) and the state itself
+  std::optional<std::tuple<const Elem *, bool, unsigned int, unsigned int>> _elem_strain_rate_key;
+  StrainRate _elem_strain_rate;
+
+  /// Number of velocity gradient evaluations performed since the last time step
+  unsigned long long _n_gradient_evaluations;
+
+  /// Number of velocity gradient evaluations avoided by the cache since the last time step
+  unsigned long long _n_gradient_evaluations_saved;
 };
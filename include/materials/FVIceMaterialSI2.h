@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FunctorMaterial.h"
+#include "GlenRheology.h"
 
 /**
  * Material objects inherit from Material and override computeQpProperties.
@@ -22,6 +23,10 @@ protected:
   const Real _AGlen;
   const Real _nGlen;
 
+  // Glen constants precomputed for the specialized rheology kernels
+  const GlenRheology::Constants _glen_constants;
+  const unsigned int _glen_exponent_tag;
+
   // density of the fluid
   const ADReal & _rho;
 
@@ -32,6 +32,9 @@ protected:
   // Slipperiness coefficient (Slip model)
   const Real & _SlipperinessCoefficient;
 
+  // Slipperiness functor replacing the constant coefficient (Slip model)
+  const Moose::Functor<Real> * const _slipperiness;
+
   // Layer thickness (Slip model)
   const Real & _LayerThickness;
 
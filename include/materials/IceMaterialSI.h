@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Material.h"
+#include "GlenRheology.h"
+
+/**
+ * Non-AD counterpart of ADIceMaterialSI_ru: Glen viscosity from the strain rate, plus its
+ * derivative with respect to the second invariant of the strain rate tensor so that the stress
+ * kernels can assemble an exact hand-coded Jacobian.
+ */
+class IceMaterialSI : public Material
+{
+public:
+  static InputParameters validParams();
+
+  IceMaterialSI(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// Quadrature point properties specialized on the Glen exponent and the mesh dimension
+  template <unsigned int N, unsigned int DIM>
+  void computeQpPropertiesTempl();
+
+  const unsigned int _mesh_dimension;
+
+  // Glen parameters
+  const Real _AGlen;
+  const Real _nGlen;
+
+  // Glen constants precomputed for the specialized rheology kernels
+  const GlenRheology::Constants _glen_constants;
+  const unsigned int _glen_exponent_tag;
+
+  // density of the fluid
+  const Real _rho;
+
+  // velocity gradients
+  const VariableGradient & _grad_velocity_x;
+  const VariableGradient & _grad_velocity_y;
+  const VariableGradient & _grad_velocity_z;
+
+  // Finite strain rate parameter
+  const Real & _rampedup_viscosity;
+
+  /// viscosity of the fluid (mu)
+  MaterialProperty<Real> & _viscosity;
+  /// derivative of the viscosity with respect to the second invariant of the strain rate
+  MaterialProperty<Real> & _dviscosity_dII_eps;
+  /// density of the fluid (rho)
+  MaterialProperty<Real> & _density;
+};
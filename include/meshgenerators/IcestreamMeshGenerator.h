@@ -0,0 +1,61 @@
+#pragma once
+
+#include "MeshGenerator.h"
+
+/**
+ * Hexahedral ice stream mesh with an optional sediment layer, built directly from the trough
+ * geometry of generate_icestream_mesh.i: x alongflow (back at x = 0, front at x = length), y
+ * acrossflow, z vertical.
+ *
+ *   bed      b(y) = channel_depth * exp(-(y - peak_position)^2 / (2 channel_width_spread^2))
+ *                   + side_elevation
+ *   surface  s(x) = front_elevation + (length - x) * surface_slope
+ *
+ * The ice (block 1) is split into terrain-following layers between b and s, the sediment (block 0)
+ * into layers between b - sediment_thickness and b. On a distributed mesh, each processor only
+ * builds its slab of alongflow columns and one layer of ghost columns.
+ *
+ * If a cache directory is given, the mesh is stored there in binary XDR format under a hash of the
+ * geometric parameters, and later runs with the same parameters read it instead of generating it.
+ */
+class IcestreamMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  IcestreamMeshGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Build the mesh from the geometric parameters
+  std::unique_ptr<MeshBase> buildMesh();
+
+  /// Bed elevation
+  Real bed(Real y) const;
+
+  /// Surface elevation
+  Real surface(Real x) const;
+
+  /// Canonical description of the geometric parameters, hashed into the cache file name
+  std::string cacheKey() const;
+
+  // geometry
+  const Real _length;
+  const Real _width;
+  const Real _channel_depth;
+  const Real _channel_width_spread;
+  const Real _side_elevation;
+  const Real _peak_position;
+  const Real _surface_slope;
+  const Real _front_elevation;
+  const Real _sinusoid_amplitude;
+  const Real _sinusoid_wavelength;
+  const Real _sediment_thickness;
+
+  // discretization
+  const unsigned int _nx;
+  const unsigned int _ny;
+  const unsigned int _nz;
+  const unsigned int _nz_sediment;
+};
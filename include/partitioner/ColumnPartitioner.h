@@ -0,0 +1,60 @@
+#pragma once
+
+#include "MoosePartitioner.h"
+
+#include <vector>
+
+/**
+ * Partitions the footprint of an extruded mesh and assigns every element of a vertical column
+ * (sediment layer and ice blocks alike) to the same processor, so that the strongly coupled
+ * vertical direction never crosses a processor boundary.
+ *
+ * The columns are balanced by their number of elements with a recursive coordinate bisection of
+ * the footprint (x, y) of their bottom elements.
+ */
+class ColumnPartitioner : public MoosePartitioner
+{
+public:
+  static InputParameters validParams();
+
+  ColumnPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  /// Partition quality measures
+  struct Statistics
+  {
+    /// Number of element faces shared by two partitions
+    dof_id_type edge_cut = 0;
+
+    /// Largest and average number of off-partition face neighbors of a partition
+    dof_id_type max_halo = 0;
+    Real average_halo = 0;
+
+    /// Number of columns spread over several partitions
+    dof_id_type split_columns = 0;
+  };
+
+  /// Partition quality of the current processor ids of a (replicated) mesh
+  static Statistics statistics(const MeshBase & mesh, unsigned int n_parts);
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /// Column of elements above a bottom element
+  struct Column
+  {
+    Point footprint;
+    dof_id_type n_elem = 0;
+    processor_id_type part = 0;
+  };
+
+  /// Assign the parts [first_part, first_part + n_parts) to the columns in [begin, end)
+  static void bisect(std::vector<Column *>::iterator begin,
+                     std::vector<Column *>::iterator end,
+                     processor_id_type first_part,
+                     processor_id_type n_parts);
+
+  /// Whether to print the edge-cut and halo statistics, compared with the Metis partition
+  const bool _report_statistics;
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "SingleMatrixPreconditioner.h"
+#include "MeshChangedInterface.h"
+#include "MeshColumns.h"
+
+#include <petscksp.h>
+
+/**
+ * Vertical line (column) block preconditioner for extruded ice meshes.
+ *
+ * The element columns are found by walking down the extrusion from each element through its
+ * bottom side (outward normal the most aligned with the downward vertical). Each column defines one PCASM subdomain holding the degrees of freedom of its
+ * elements, so that with
+ *
+ *   -pc_type asm -pc_asm_overlap 0 -sub_ksp_type preonly -sub_pc_type lu
+ *
+ * the strongly coupled vertical direction is solved exactly, one column block at a time. The
+ * matrix is assembled as with SMP.
+ */
+class ColumnBlockPreconditioner : public SingleMatrixPreconditioner, public MeshChangedInterface
+{
+public:
+  static InputParameters validParams();
+
+  ColumnBlockPreconditioner(const InputParameters & params);
+  virtual ~ColumnBlockPreconditioner();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  /// Build one index set per element column from the local elements
+  void buildColumns();
+
+  /// Register the hook handing the columns to PCASM on the current Krylov solver
+  void attachToSolver();
+
+  /// Release the column index sets
+  void destroyColumns();
+
+  /// Hook giving the columns to PCASM before the preconditioner is set up
+  static PetscErrorCode preSolve(KSP ksp, Vec rhs, Vec sol, void * ctx);
+
+  /// Variables included in the column blocks (all the variables if empty)
+  std::vector<unsigned int> _column_variables;
+
+  /// Column index sets (global dof indices owned by this processor)
+  std::vector<IS> _columns;
+
+  /// Bottom element of the column containing an element
+  MeshColumns::BottomFinder _column_bottom;
+
+  /// Whether the current columns were handed to PCASM
+  bool _columns_set;
+};
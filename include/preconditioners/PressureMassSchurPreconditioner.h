@@ -0,0 +1,53 @@
+#pragma once
+
+#include "FieldSplitPreconditioner.h"
+#include "MeshChangedInterface.h"
+
+#include <petscksp.h>
+
+/**
+ * Schur complement field split preconditioned by the viscosity-weighted pressure mass matrix.
+ *
+ * The IcePressureMassMatrix (FE) or FVIcePressureMassMatrix (FV) kernels assemble -M_p/mu into a
+ * separate tagged matrix (extra_tag_matrices of the [Problem]), so that the preconditioning
+ * matrix, and with it the Schur complement S = A11 - A10 A00^-1 A01 PETSc builds from its
+ * blocks, are left untouched. Before each linear solve its pressure-pressure block is handed to
+ * the top split with PCFieldSplitSetSchurPre(pc, PC_FIELDSPLIT_SCHUR_PRE_USER, Mp), the
+ * spectrally equivalent approximation of S for variable-viscosity Stokes problems.
+ *
+ * The splits are set up as with FSP, the top split being the Schur split.
+ */
+class PressureMassSchurPreconditioner : public FieldSplitPreconditioner,
+                                        public MeshChangedInterface
+{
+public:
+  static InputParameters validParams();
+
+  PressureMassSchurPreconditioner(const InputParameters & params);
+  virtual ~PressureMassSchurPreconditioner();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  /// Build the index set of the locally owned pressure dofs
+  void buildPressureIS();
+
+  /// Release the pressure index set and mass matrix block
+  void destroy();
+
+  /// Hook handing the pressure mass matrix block to the Schur split before each linear solve
+  static PetscErrorCode preSolve(KSP ksp, Vec rhs, Vec sol, void * ctx);
+
+  /// Tag of the matrix the mass matrix kernels assemble into
+  TagID _mass_tag;
+
+  /// Pressure variable (second split)
+  unsigned int _pressure_var;
+
+  /// Locally owned pressure dofs, in the (sorted) order of the pressure split
+  IS _pressure_is;
+
+  /// Pressure-pressure block of the mass matrix
+  Mat _mass_block;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "TimeStepper.h"
+
+/**
+ * Switched evolution relaxation (SER) pseudo-transient continuation towards a steady state.
+ *
+ * The time step grows with the inverse of the steady residual reduction between two time steps,
+ * dt_{n+1} = dt_n * (|R_{n-1}| / |R_n|)^p, so that the time derivative terms vanish and the solve
+ * turns into a pure Newton solve as the steady state is approached.
+ */
+class SERTimeStepper : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+
+  SERTimeStepper(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  /// Initial time step
+  const Real _initial_dt;
+
+  /// Largest time step, beyond which the solve is a Newton solve of the steady problem
+  const Real _dt_max;
+
+  /// Exponent of the residual reduction ratio
+  const Real _exponent;
+
+  /// Bounds of the ratio between two consecutive time steps
+  const Real _max_growth;
+  const Real _max_reduction;
+
+  /// Steady residual norm at the beginning of the current time step
+  const PostprocessorValue & _steady_residual;
+
+  /// Steady residual norm of the previous time step, restartable so that the time step history
+  /// (and the time derivative terms) is preserved when restarting from a checkpoint
+  Real & _previous_residual;
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <unordered_map>
+
+/**
+ * Vertical stretch of the ice columns of an extruded mesh following the evolution of a surface
+ * elevation variable, defined on a lower-dimensional block built from the surface sideset.
+ *
+ * Nodes are grouped into columns by their reference horizontal position. Each ice node moves
+ * vertically by (s - s_ref) * (z_ref - b) / (s_ref - b), with s the current surface elevation of
+ * its column, s_ref and b the reference surface and base of the ice: the base (and the sediment
+ * below it) stays in place and the top follows the surface.
+ */
+class ColumnSurfaceEvolution : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ColumnSurfaceEvolution(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /// Vertical displacement of a node (zero outside of the ice columns)
+  Real verticalDisplacement(const Node & node) const;
+
+protected:
+  /// Group the ice nodes into columns
+  void buildColumns();
+
+  /// Vertical direction (the last mesh direction)
+  const unsigned int _vertical;
+
+  /// Horizontal distance under which two nodes belong to the same column
+  const Real _tolerance;
+
+  /// Surface elevation variable
+  const MooseVariableFieldBase & _surface_var;
+
+  /// Reference surface, base and top node of each column
+  std::vector<Real> _reference_surface;
+  std::vector<Real> _base;
+  std::vector<const Node *> _top_node;
+
+  /// Current surface elevation of each column
+  std::vector<Real> _surface;
+
+  /// Column of each ice node
+  std::unordered_map<dof_id_type, std::size_t> _node_column;
+};
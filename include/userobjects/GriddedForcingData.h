@@ -0,0 +1,83 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * Gridded forcing field f(x, y, t) read from a memory-mapped binary file and interpolated
+ * bilinearly in space and linearly in time.
+ *
+ * File layout (native byte order):
+ *   char     magic[8] = "DIUCAGRD"
+ *   uint64   nx, ny, nt
+ *   float64  x[nx], y[ny], t[nt]   (strictly increasing, possibly non-uniform)
+ *   float64  f[nt][ny][nx]
+ *
+ * The file is mapped read-only, so large rasters are shared through the page cache instead of
+ * being copied to the heap. The cell containing each local element centroid is located once, and
+ * quadrature point queries start their search from it.
+ */
+class GriddedForcingData : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  GriddedForcingData(const InputParameters & parameters);
+  virtual ~GriddedForcingData();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Interpolated value at a point and time, the element (if any) providing a cell guess
+  Real value(const Point & p, Real t, const Elem * elem = nullptr) const;
+
+  /// Whether the data has a time dimension
+  bool isTimeDependent() const { return _nt > 1; }
+
+protected:
+  /// Locate the cell of every local element centroid
+  void buildElementCellCache();
+
+  /// Index i such that axis[i] <= x < axis[i + 1], clamped to the first/last interval
+  static std::size_t locate(const Real * axis, std::size_t n, Real x);
+
+  /// Same as locate, checking the guessed interval first
+  static std::size_t locate(const Real * axis, std::size_t n, Real x, std::size_t guess);
+
+  /// Interpolation weight of x in [axis[i], axis[i + 1]], clamped to [0, 1]
+  static Real weight(const Real * axis, std::size_t i, Real x);
+
+  /// Data value at the grid node (i, j) of time slice k
+  Real node(std::size_t i, std::size_t j, std::size_t k) const
+  {
+    return _values[(k * _ny + j) * _nx + i];
+  }
+
+  /// Scale applied to the interpolated values
+  const Real _scale;
+
+  /// Mapped file
+  void * _map;
+  std::size_t _map_size;
+
+  /// Grid sizes
+  std::uint64_t _nx;
+  std::uint64_t _ny;
+  std::uint64_t _nt;
+
+  /// Grid axes and values (pointers into the mapped file)
+  const Real * _x;
+  const Real * _y;
+  const Real * _t;
+  const Real * _values;
+
+  /// (i, j) cell of the local element centroids
+  std::unordered_map<dof_id_type, std::array<std::size_t, 2>> _elem_cells;
+};
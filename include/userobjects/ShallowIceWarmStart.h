@@ -0,0 +1,91 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Shallow-ice (SIA) solution on the 2D footprint of an extruded ice mesh, extended vertically to
+ * give initial velocity and pressure fields for the Full-Stokes solve.
+ *
+ * The surface and bed elevations are read from the ice mesh nodes onto a regular footprint grid.
+ * The surface is smoothed, then each column gets the local SIA velocity profile
+ *   u(z) = u_b - 2 A (rho g)^n |grad s|^(n-1) grad s (H^(n+1) - (s - z)^(n+1)) / (n + 1)
+ * with a linear basal sliding u_b = -C rho g H grad s. The pressure is hydrostatic,
+ * p = rho g (s - z). Below the ice base (sediment layer), the sliding velocity decays linearly to
+ * zero over the sediment thickness.
+ */
+class ShallowIceWarmStart : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ShallowIceWarmStart(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Initial velocity at a point
+  RealVectorValue velocity(const Point & p) const;
+
+  /// Initial (hydrostatic) pressure at a point
+  Real pressure(const Point & p) const;
+
+protected:
+  /// Footprint fields interpolated at a point
+  struct Column
+  {
+    Real surface;
+    Real bed;
+    RealVectorValue grad_surface;
+  };
+
+  /// Read the surface and bed elevations from the mesh and compute the surface slopes
+  void buildFootprint();
+
+  /// Bilinear interpolation of the footprint fields at the horizontal position of a point
+  Column column(const Point & p) const;
+
+  /// Index of the footprint cell (i, j)
+  std::size_t index(unsigned int i, unsigned int j) const { return j * _nx + i; }
+
+  /// Vertical direction (the last mesh direction)
+  const unsigned int _vertical;
+
+  /// Footprint grid size
+  const unsigned int _nx;
+  const unsigned int _ny;
+
+  /// Number of smoothing passes of the surface elevation
+  const unsigned int _smoothing_passes;
+
+  /// Ice blocks defining the surface and bed elevations
+  std::set<SubdomainID> _ice_blocks;
+
+  // Glen parameters
+  const Real _AGlen;
+  const Real _nGlen;
+
+  // ice density and gravity acceleration
+  const Real _rho;
+  const Real _g;
+
+  /// Linear sliding slipperiness (m Pa-1 s-1), no sliding if zero
+  const Real _slipperiness;
+
+  /// Thickness of the sediment layer below the ice base
+  const Real _sediment_thickness;
+
+  /// Footprint bounding box and cell sizes
+  Real _xmin;
+  Real _ymin;
+  Real _dx;
+  Real _dy;
+
+  /// Cell-centered surface and bed elevations and surface slopes
+  std::vector<Real> _surface;
+  std::vector<Real> _bed;
+  std::vector<RealVectorValue> _grad_surface;
+};
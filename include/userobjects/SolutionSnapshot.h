@@ -0,0 +1,75 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * Memory-mapped solution snapshot written by SolutionSnapshotWriter, sampled at arbitrary points
+ * to restart on a different mesh (refined, calved) or rank count.
+ *
+ * File layout (native byte order, all entries 8 bytes wide):
+ *   char     magic[8] = "DIUCASNP"
+ *   uint64   n_points, n_fields, nbx, nby, nbz
+ *   float64  min[3], max[3]                     (bounding box of the points)
+ *   uint64   bin_offsets[nbx * nby * nbz + 1]   (bins ordered x fastest)
+ *   char     names[n_fields][64]
+ *   float64  points[n_points][3]                (sorted by bin)
+ *   float64  values[n_fields][n_points]
+ *
+ * Each rank maps the file read-only, so only the pages of the bins around its own elements are
+ * read. A query returns the value of a coincident point if any, otherwise the inverse distance
+ * weighted average of the points of the surrounding bins.
+ */
+class SolutionSnapshot : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  SolutionSnapshot(const InputParameters & parameters);
+  virtual ~SolutionSnapshot();
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Index of a field, mooseError if the snapshot does not contain it
+  unsigned int fieldIndex(const std::string & name) const;
+
+  /// Whether the snapshot contains a field
+  bool hasField(const std::string & name) const { return _field_index.count(name); }
+
+  /// Value of a field at a point
+  Real value(unsigned int field, const Point & p) const;
+
+  static constexpr std::size_t name_size = 64;
+
+protected:
+  /// Bin index along one direction, clamped to the grid
+  std::int64_t bin(unsigned int d, Real x) const;
+
+  /// Mapped file
+  void * _map;
+  std::size_t _map_size;
+
+  /// Number of points and fields
+  std::uint64_t _n_points;
+  std::uint64_t _n_fields;
+
+  /// Bin grid
+  std::uint64_t _n_bins[3];
+  Real _min[3];
+  Real _bin_size[3];
+
+  /// Tolerance under which a point is coincident with a query point
+  Real _tolerance;
+
+  /// Pointers into the mapped file
+  const std::uint64_t * _bin_offsets;
+  const Real * _points;
+  const Real * _values;
+
+  /// Field names to indices
+  std::unordered_map<std::string, unsigned int> _field_index;
+};
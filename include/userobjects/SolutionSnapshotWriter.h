@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Writes variables as a binary solution snapshot (DIUCASNP format, see SolutionSnapshot) that can
+ * be loaded in parallel onto any mesh and rank count.
+ *
+ * The values are taken at the mesh nodes (nodal variables) or at the element centroids (elemental
+ * and finite volume variables, constant part only), gathered on the first rank and sorted into a
+ * regular grid of spatial bins, so that readers only touch the bins around their own elements.
+ */
+class SolutionSnapshotWriter : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  SolutionSnapshotWriter(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Sort the gathered points into bins and write the file (first rank only)
+  void write(const std::vector<Real> & points, const std::vector<Real> & values) const;
+
+  /// Snapshot file
+  const FileName & _file;
+
+  /// Variables written to the snapshot
+  const std::vector<VariableName> & _variables;
+
+  /// Whether the variables are sampled at the nodes (or at the element centroids)
+  const bool _nodal;
+
+  /// Target average number of points per bin
+  const unsigned int _points_per_bin;
+
+  /// Names of the written fields (one per component of vector variables)
+  std::vector<std::string> _field_names;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+// MOOSE includes
+#include "MooseTypes.h"
+#include "MooseEnum.h"
+#include "InputParameters.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Basal friction equivalent to a thin sediment layer of viscosity mu_sediment and thickness h
+ * lying on a no-slip bed: the layer shear stress mu_sediment * u / h is applied directly as the
+ * traction -beta * u on the ice base, with beta = mu_sediment / h.
+ *
+ * - GudmundssonRaymond: mu_sediment = h / C, hence beta = 1 / C (linear sliding law)
+ * - DruckerPrager: mu_sediment = mu_f * p / eps_e, with the effective strain rate of the layer in
+ *   simple shear eps_e = |u| / (2 h) bounded below by sqrt(II_eps_min), hence a regularized
+ *   Coulomb law |tau| = 2 mu_f p
+ */
+namespace BasalFriction
+{
+/// Sliding law parameters shared by the FE and FV basal friction boundary conditions
+inline void
+addParams(InputParameters & params)
+{
+  MooseEnum sliding_law("GudmundssonRaymond DruckerPrager", "GudmundssonRaymond");
+  params.addParam<MooseEnum>("sliding_law", sliding_law, "Sliding law of the sediment");
+
+  // Slip model
+  params.addParam<Real>("SlipperinessCoefficient", 1.0, "Sediment slipperiness coefficient");
+  params.declareControllable("SlipperinessCoefficient");
+  params.addParam<Real>("LayerThickness", 1.0, "Equivalent sediment layer thickness"); // m
+  params.declareControllable("LayerThickness");
+
+  // DruckerPrager model
+  params.addParam<Real>("FrictionCoefficient", 1.0, "Sediment friction coefficient");
+  params.declareControllable("FrictionCoefficient");
+  params.addParam<Real>("II_eps_min", 1e-25, "Finite strain rate parameter"); // s-1
+  params.declareControllable("II_eps_min");
+}
+
+/// Friction coefficient beta (Pa s m-1) of the equivalent sediment layer
+template <typename T>
+T
+coefficient(const bool drucker_prager,
+            const Real slipperiness,
+            const Real thickness,
+            const Real friction,
+            const Real II_eps_min,
+            const T & pressure,
+            const T & speed)
+{
+  if (!drucker_prager)
+    return T(1. / slipperiness);
+
+  using std::max;
+  const T eps_e = max(T(speed / (2. * thickness)), T(std::sqrt(II_eps_min)));
+  return friction * pressure / (eps_e * thickness);
+}
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Compile-time specialized kernels of Glen's flow law shared by the ice materials.
+ *
+ * The viscosity is specialized on the Glen exponent (closed-form paths for n=1 and n=3, std::pow
+ * otherwise) and the second invariant of the strain rate tensor on the mesh dimension, so that the
+ * components vanishing in 2D are never touched. Materials select the specialization once at
+ * construction and call into it through GlenRheology::dispatch.
+ */
+namespace GlenRheology
+{
+/// Exponent tag used for Glen exponents without a closed-form implementation
+constexpr unsigned int generic_exponent = 0;
+
+/**
+ * Constants of Glen's flow law, precomputed once from the fluidity parameter and the exponent
+ */
+struct Constants
+{
+  Constants(const Real A, const Real n)
+    : half_A_inv_n(0.5 * std::pow(A, -1. / n)), strain_rate_exponent(-(1. - 1. / n) / 2.)
+  {
+  }
+
+  /// 0.5 * A^(-1/n)
+  const Real half_A_inv_n;
+
+  /// -(1 - 1/n) / 2, the exponent of the second invariant of the strain rate
+  const Real strain_rate_exponent;
+};
+
+/**
+ * x^(-1/3) with a single cbrt on the value, the derivatives following from the chain rule
+ */
+inline Real
+inverseCbrt(const Real x)
+{
+  return 1. / std::cbrt(x);
+}
+
+inline ADReal
+inverseCbrt(const ADReal & x)
+{
+  const Real value = MetaPhysicL::raw_value(x);
+  const Real f = 1. / std::cbrt(value);
+
+  ADReal result = x;
+  result.value() = f;
+  result.derivatives() *= -f / (3. * value);
+  return result;
+}
+
+/**
+ * II_eps^(-(1-1/n)/2) for a given Glen exponent
+ */
+template <unsigned int N>
+struct StrainRateFactor
+{
+  template <typename T>
+  static T compute(const T & II_eps, const Constants & constants)
+  {
+    using std::pow;
+    return pow(II_eps, constants.strain_rate_exponent);
+  }
+};
+
+/// Newtonian fluid: the viscosity does not depend on the strain rate
+template <>
+struct StrainRateFactor<1>
+{
+  template <typename T>
+  static T compute(const T &, const Constants &)
+  {
+    return T(1.);
+  }
+};
+
+/// Glen's standard exponent: II_eps^(-1/3)
+template <>
+struct StrainRateFactor<3>
+{
+  template <typename T>
+  static T compute(const T & II_eps, const Constants &)
+  {
+    return inverseCbrt(II_eps);
+  }
+};
+
+/**
+ * Glen viscosity 0.5 * A^(-1/n) * II_eps^(-(1-1/n)/2)
+ */
+template <unsigned int N, typename T>
+T
+viscosity(const T & II_eps, const Constants & constants)
+{
+  return constants.half_A_inv_n * StrainRateFactor<N>::compute(II_eps, constants);
+}
+
+/**
+ * Second invariant of the strain rate tensor, out-of-plane components are skipped in 2D
+ */
+template <unsigned int DIM, typename T>
+T
+secondInvariant(const T & eps_xx,
+                const T & eps_yy,
+                const T & eps_zz,
+                const T & eps_xy,
+                const T & eps_xz,
+                const T & eps_yz)
+{
+  if constexpr (DIM == 3)
+    return 0.5 * (eps_xx * eps_xx + eps_yy * eps_yy + eps_zz * eps_zz +
+                  2. * (eps_xy * eps_xy + eps_xz * eps_xz + eps_yz * eps_yz));
+  else
+    return 0.5 * (eps_xx * eps_xx + eps_yy * eps_yy + 2. * eps_xy * eps_xy);
+}
+
+/**
+ * Strain rate values of all the quadrature points of an element in a structure-of-arrays layout,
+ * so that the value part of Glen's law is computed in loops the compiler can vectorize
+ */
+struct StrainRateBatch
+{
+  void resize(const std::size_t n)
+  {
+    for (auto * v : {&eps_xx, &eps_yy, &eps_zz, &eps_xy, &eps_xz, &eps_yz, &II_eps, &mu})
+      v->resize(n);
+  }
+
+  std::size_t size() const { return II_eps.size(); }
+
+  std::vector<Real> eps_xx;
+  std::vector<Real> eps_yy;
+  std::vector<Real> eps_zz;
+  std::vector<Real> eps_xy;
+  std::vector<Real> eps_xz;
+  std::vector<Real> eps_yz;
+
+  std::vector<Real> II_eps;
+  std::vector<Real> mu;
+};
+
+/**
+ * Second invariant and viscosity for all the entries of a batch (value part only, for
+ * residual-only evaluations: no derivative, so a zero invariant is never divided by)
+ */
+template <unsigned int N, unsigned int DIM>
+void
+computeBatch(StrainRateBatch & batch, const Constants & constants)
+{
+  const std::size_t n = batch.size();
+  const Real * const exx = batch.eps_xx.data();
+  const Real * const eyy = batch.eps_yy.data();
+  const Real * const ezz = batch.eps_zz.data();
+  const Real * const exy = batch.eps_xy.data();
+  const Real * const exz = batch.eps_xz.data();
+  const Real * const eyz = batch.eps_yz.data();
+  Real * const II = batch.II_eps.data();
+  Real * const mu = batch.mu.data();
+
+  for (std::size_t i = 0; i < n; ++i)
+    II[i] = secondInvariant<DIM>(exx[i], eyy[i], ezz[i], exy[i], exz[i], eyz[i]);
+
+  if constexpr (N == 1)
+    for (std::size_t i = 0; i < n; ++i)
+      mu[i] = constants.half_A_inv_n;
+  else
+    for (std::size_t i = 0; i < n; ++i)
+      mu[i] = viscosity<N>(II[i], constants);
+}
+
+/**
+ * Exponent tag for a runtime Glen exponent
+ */
+inline unsigned int
+exponentTag(const Real n)
+{
+  if (n == 3.)
+    return 3;
+  if (n == 1.)
+    return 1;
+  return generic_exponent;
+}
+
+/**
+ * Call f(std::integral_constant<unsigned int, N>, std::integral_constant<unsigned int, DIM>) with
+ * the specialization matching the exponent tag and mesh dimension (1D shares the 2D kernels)
+ */
+template <typename F>
+decltype(auto)
+dispatch(const unsigned int exponent_tag, const unsigned int dim, F && f)
+{
+  using Three = std::integral_constant<unsigned int, 3>;
+  using Two = std::integral_constant<unsigned int, 2>;
+  using One = std::integral_constant<unsigned int, 1>;
+  using Generic = std::integral_constant<unsigned int, generic_exponent>;
+
+  if (dim == 3)
+    switch (exponent_tag)
+    {
+      case 3:
+        return f(Three(), Three());
+      case 1:
+        return f(One(), Three());
+      default:
+        return f(Generic(), Three());
+    }
+  else
+    switch (exponent_tag)
+    {
+      case 3:
+        return f(Three(), Two());
+      case 1:
+        return f(One(), Two());
+      default:
+        return f(Generic(), Two());
+    }
+}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+#include "libmesh/elem.h"
+
+#include <unordered_map>
+
+/**
+ * Vertical element columns of extruded meshes (ice blocks and sediment layer), found by walking
+ * down from each element through its bottom side to the bed. The vertical direction is the last
+ * coordinate of the mesh (y in 2D, z in 3D).
+ */
+namespace MeshColumns
+{
+/**
+ * Side of an element whose outward normal is the most aligned with the vertical direction
+ * (direction = 1, top side) or its opposite (direction = -1, bottom side)
+ */
+unsigned int verticalSide(const Elem * elem, unsigned int vertical, int direction);
+
+/// Neighbor through the bottom side of an element (nullptr at the bed or at a remote element)
+const Elem * lowerNeighbor(const Elem * elem, unsigned int vertical);
+
+/**
+ * Bottom element of the column containing an element, memoized for every element visited.
+ * Lower-dimensional elements belong to the column of their interior parent.
+ */
+class BottomFinder
+{
+public:
+  /// Columns of a mesh of dimension 2 or 3
+  BottomFinder(unsigned int mesh_dimension);
+
+  const Elem * operator()(const Elem * elem);
+
+  void clear() { _bottom.clear(); }
+
+private:
+  /// Mesh dimension and vertical coordinate
+  const unsigned int _dim;
+  const unsigned int _vertical;
+
+  std::unordered_map<const Elem *, const Elem *> _bottom;
+};
+}
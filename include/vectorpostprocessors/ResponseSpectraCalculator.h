@@ -22,6 +22,12 @@
  *  ResponseSpectraCalculator is a type of VectorPostprocessor that computes the
  *  response spectra (pseudo displacement, pseudo velocity and pseudo
  *  acceleration) for the given acceleration response variables.
+ *
+ *  In incremental mode, the Newmark state of the single-degree-of-freedom
+ *  oscillator of every frequency and history is kept between executions, and
+ *  only the regularized samples added since the last execution are integrated,
+ *  so that the spectra can be updated at every time step in O(N_freq) per
+ *  sample instead of reprocessing the whole history.
  */
 
 class ResponseSpectraCalculator : public GeneralVectorPostprocessor
@@ -34,6 +40,14 @@ public:
   virtual void execute() override;
 
 protected:
+  /// Regularize and integrate the history samples received since the last
+  /// execution (incremental mode).
+  void executeIncremental();
+
+  /// Advance the oscillators of history i by one regularized acceleration
+  /// sample.
+  void advance(std::size_t i, Real acc);
+
   /// Damping ratio.
   const Real & _xi;
 
@@ -68,6 +82,28 @@ protected:
 
   /// Vector containing the time values in the simulation.
   const VectorPostprocessorValue & _history_time;
+
+  /// Whether the oscillator states are advanced incrementally.
+  const bool _incremental;
+
+  /// Natural circular frequency, damping term (xi * om_n) and Newmark
+  /// denominator of each oscillator (incremental mode).
+  std::vector<Real> _om_n;
+  std::vector<Real> _om_d;
+  std::vector<Real> _kd;
+
+  /// Displacement, velocity, acceleration and peak displacement of the
+  /// oscillators, indexed by history then frequency (incremental mode).
+  std::vector<std::vector<Real>> & _dis;
+  std::vector<std::vector<Real>> & _vel;
+  std::vector<std::vector<Real>> & _acc;
+  std::vector<std::vector<Real>> & _peak;
+
+  /// Next regularized time, first history interval not fully regularized yet
+  /// and number of regularized samples integrated (incremental mode).
+  Real & _reg_time;
+  std::size_t & _interval;
+  std::size_t & _n_samples;
 };
 
 #endif
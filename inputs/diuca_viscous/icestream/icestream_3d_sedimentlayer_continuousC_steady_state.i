@@ -16,6 +16,17 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
 
 [Mesh]
 
+  # The ice stream and its sediment layer can be built in one step instead of
+  # reading generate_icestream_mesh_out.e and extruding the sediment below it,
+  # the mesh being cached on disk for later runs with the same geometry
+  # (feed final_mesh with input = icestream)
+  # [icestream]
+  #   type = IcestreamMeshGenerator
+  #   sediment_thickness = ${sediment_layer_thickness}
+  #   nb_elements_sediment = 1
+  #   cache_directory = mesh_cache
+  # []
+
   [channel]
     type = FileMeshGenerator
     file = generate_icestream_mesh_out.e
@@ -103,6 +114,15 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
 []
 
 [Functions]
+  [warm_start_velocity]
+    type = ShallowIceWarmStartFunction
+    warm_start = warm_start
+  []
+  [warm_start_pressure]
+    type = ShallowIceWarmStartFunction
+    warm_start = warm_start
+    field = pressure
+  []
   # [viscosity_rampup]
   #   type = ParsedFunction
   #   expression = 'initial_viscosity + t * rampup_rate'
@@ -198,8 +218,23 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
     function = 'viscosity_rampup'
     execute_on = 'initial timestep_begin'
   []
+  # ramp driven by the nonlinear convergence instead of the hand-tuned
+  # viscosity_rampup (needs the nl_its postprocessor below)
+  # [viscosity_rampup_control]
+  #   type = AdaptiveRegularizationControl
+  #   parameter = 'Materials/ice/rampedup_viscosity'
+  #   initial_value = 1e12
+  #   target_value = 2e14
+  #   nonlinear_iterations = nl_its
+  # []
 []
 
+# [Postprocessors]
+#   [nl_its]
+#     type = NumNonlinearIterations
+#   []
+# []
+
 
 [AuxVariables]
   [vel_x]
@@ -238,22 +273,68 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
   [velocity]
     family = LAGRANGE_VEC
     scaling = 1e-6
-    initial_condition = 1e-6
     block = '1 0 255 256'
   []
   [p]
     family = LAGRANGE
-    initial_condition = 1e6
     block = '1 0 255 256'
   []
 []
 
+# Warm start: shallow-ice velocity and hydrostatic pressure computed on the
+# footprint of the ice and extended vertically, instead of starting from rest
+[UserObjects]
+  [warm_start]
+    type = ShallowIceWarmStart
+    ice_blocks = '1 255'
+    nx = 50
+    ny = 20
+    SlipperinessCoefficient = 5e-11
+    sediment_thickness = ${sediment_layer_thickness}
+  []
+  # steady state for restarts on another mesh or rank count (see the
+  # transient input)
+  [snapshot_writer]
+    type = SolutionSnapshotWriter
+    file = icestream_3d_sedimentlayer_continuousC_steady_state.snp
+    variables = 'velocity p'
+  []
+[]
+
+[ICs]
+  [velocity]
+    type = VectorFunctionIC
+    variable = velocity
+    function = warm_start_velocity
+  []
+  [p]
+    type = FunctionIC
+    variable = p
+    function = warm_start_pressure
+  []
+[]
+
 [Kernels] 
   [mass_ice]
     type = INSADMass
     block = '1 255'
     variable = p
   []
+  # Viscosity-weighted pressure mass matrix, only assembled into the
+  # 'pressure_mass' tagged matrix (see the FSP_mass preconditioner), which
+  # needs extra_tag_matrices = 'pressure_mass' in a [Problem] block
+  # [pressure_mass_matrix_ice]
+  #   type = IcePressureMassMatrix
+  #   block = '1 255'
+  #   variable = p
+  #   mu_name = "mu_ice"
+  # []
+  # [pressure_mass_matrix_sediment]
+  #   type = IcePressureMassMatrix
+  #   block = '0 256'
+  #   variable = p
+  #   mu_name = "mu_sediment"
+  # []
   [mass_stab_ice_ice]
     type = INSADMassPSPG
     block = '1 255'
@@ -375,6 +456,28 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
     function_z = 0.
   []
 
+  # Without the extruded sediment layer, the equivalent basal friction
+  # is applied directly on the ice base (uniform slipperiness, i.e.
+  # LayerThickness / mu_sediment, not the continuous map of the material).
+  # It only resists the tangential velocity, the flow through the bed is
+  # blocked separately (no_penetration)
+  # [basal_friction]
+  #   type = INSADBasalFrictionBC
+  #   variable = velocity
+  #   boundary = 'bottom'
+  #   sliding_law = GudmundssonRaymond
+  #   SlipperinessCoefficient = 5e-11
+  #   LayerThickness = ${sediment_layer_thickness}
+  # []
+  # [no_penetration]
+  #   type = ADVectorFunctionDirichletBC
+  #   variable = velocity
+  #   boundary = 'bottom'
+  #   function_z = 0.
+  #   set_x_comp = false
+  #   set_y_comp = false
+  # []
+
   [no_vertical_ice_sediment_boundary]
     type = ADVectorFunctionDirichletBC
     variable = velocity
@@ -426,6 +529,12 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
     velocity_y = "vel_y"
     velocity_z = "vel_z"
     pressure = "p"
+    # Picard iterations (frozen viscosity) until the residual drops below
+    # the switch tolerance, then full Newton
+    # picard_residual = nl_residual
+    # newton_switch_tolerance = 1e-02
+    # stresses are only needed for output
+    output_only_stresses = true
     output_properties = 'mu_ice rho_ice
                          sig_xx_dev sig_yy_dev
                          sig_zz_dev sig_xy_dev
@@ -461,6 +570,13 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
 []
 
 
+# [Postprocessors]
+#   [nl_residual]
+#     type = Residual
+#     execute_on = 'linear nonlinear'
+#   []
+# []
+
 [Preconditioning]
   active = ''
   [FSP]
@@ -507,6 +623,38 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
       petsc_options_value = 'gmres    300                5e-1      jacobi    right'
     []
   []
+  # Schur complement preconditioned by the -M_p/mu block assembled by the
+  # IcePressureMassMatrix kernels, AMG on the velocity block, no direct
+  # factorization
+  [FSP_mass]
+    type = PressureMassSchurPreconditioner
+    pressure = p
+    topsplit = 'up'
+    [up]
+      splitting = 'u p'
+      splitting_type = schur
+      petsc_options_iname = '-pc_fieldsplit_schur_fact_type  -ksp_gmres_restart -ksp_rtol -ksp_type'
+      petsc_options_value = 'upper                           300                1e-4      fgmres'
+    []
+    [u]
+      vars = 'velocity'
+      petsc_options_iname = '-pc_type -pc_hypre_type -ksp_type -ksp_rtol'
+      petsc_options_value = 'hypre    boomeramg      preonly  1e-2'
+    []
+    [p]
+      vars = 'p'
+      petsc_options_iname = '-pc_type -ksp_type -ksp_rtol'
+      petsc_options_value = 'jacobi   gmres     1e-2'
+    []
+  []
+  # One exact (LU) block solve per vertical element column of the
+  # extruded mesh, the strongly coupled direction of thin ice
+  [columns]
+    type = ColumnBlockPreconditioner
+    full = true
+    petsc_options_iname = '-pc_type -pc_asm_overlap -sub_ksp_type -sub_pc_type -sub_pc_factor_shift_type -ksp_type -ksp_gmres_restart'
+    petsc_options_value = 'asm      0               preonly       lu           NONZERO                   gmres     300'
+  []
   [SMP]
     type = SMP
     full = true
@@ -515,10 +663,62 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
   []
 []
 
+# Refinement driven by the viscosity and strain rate jumps (shear margins,
+# front), instead of refining up front in the [Mesh] block. The FE viscosity
+# is seen by the indicator through an elemental auxiliary variable
+# [Adaptivity]
+#   marker = jump_marker
+#   interval = 5
+#   max_h_level = 2
+#   [Indicators]
+#     [viscosity_jump]
+#       type = ViscosityJumpIndicator
+#       block = '1 255'
+#       viscosity = mu_ice_elem
+#       velocity_x = vel_x
+#       velocity_y = vel_y
+#       velocity_z = vel_z
+#     []
+#   []
+#   [Markers]
+#     [jump_marker]
+#       type = JumpThresholdMarker
+#       indicator = viscosity_jump
+#       refine = 0.2
+#       coarsen = 0.02
+#     []
+#   []
+# []
+#
+# [AuxVariables]
+#   [mu_ice_elem]
+#     order = CONSTANT
+#     family = MONOMIAL
+#   []
+# []
+#
+# [AuxKernels]
+#   [mu_ice_elem]
+#     type = ADMaterialRealAux
+#     variable = mu_ice_elem
+#     property = mu_ice
+#     block = '1 255'
+#   []
+# []
+
 [Executioner]
   type = Transient
   num_steps = 50
 
+  # Grid sequencing: remove refined_mesh from the [Mesh] block (final_generator
+  # = final_mesh2), solve to steady state on the coarse mesh with loose
+  # tolerances, then refine block 255 and carry on from the projected solution
+  # type = GridSequencedTransient
+  # num_levels = 2
+  # refine_blocks = '255'
+  # coarse_nl_rel_tol = 1e-03
+  # coarse_steady_state_tolerance = 1e-08
+
   petsc_options_iname = '-pc_type -pc_factor_shift_type'
   petsc_options_value = 'lu       NONZERO'
   
@@ -23,7 +23,40 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
   file = icestream_3d_sedimentlayer_continuousC_steady_state_out_cp/LATEST # ${initial_file}
 []
 
+# Restart on another mesh (e.g. refined or calved) or rank count: remove the
+# [Problem] block and the initial_from_file_var parameters, load the mesh
+# with a FileMeshGenerator and project the steady state snapshot
+# [UserObjects]
+#   [steady_state]
+#     type = SolutionSnapshot
+#     file = icestream_3d_sedimentlayer_continuousC_steady_state.snp
+#   []
+# []
+#
+# [ICs]
+#   [velocity]
+#     type = VectorFunctionIC
+#     variable = velocity
+#     function = steady_state_velocity
+#   []
+#   [p]
+#     type = FunctionIC
+#     variable = p
+#     function = steady_state_pressure
+#   []
+# []
+
 [Functions]
+  # [steady_state_velocity]
+  #   type = SolutionSnapshotFunction
+  #   snapshot = steady_state
+  #   field = velocity
+  # []
+  # [steady_state_pressure]
+  #   type = SolutionSnapshotFunction
+  #   snapshot = steady_state
+  #   field = p
+  # []
   [viscosity_rampup]
     type = ParsedFunction
     expression = '2e14'
@@ -286,6 +319,8 @@ _dt = '${fparse nb_years * 3600 * 24 * 365}'
     velocity_y = "vel_y"
     velocity_z = "vel_z"
     pressure = "p"
+    # stresses are only needed for output
+    output_only_stresses = true
     output_properties = 'mu_ice rho_ice
                          sig_xx_dev sig_yy_dev
                          sig_zz_dev sig_xy_dev
@@ -38,13 +38,22 @@ inlet_mps = ${fparse
   integrate_p_by_parts = false
 []
 
-[Problem]
-  #Note that the suffix is left off in the parameter below.
-  restart_file_base = icestream_3d_sedimentlayer_steady_state_displacedmesh_out_cp/LATEST  # You may also use a specific number here
-[]
-
+# The surface elevation lives on a lower-dimensional block built from the
+# surface sideset, the ice columns are stretched vertically to follow it
+# (the mesh must be replicated)
 [Mesh]
-  file = icestream_3d_sedimentlayer_steady_state_displacedmesh_out_cp/LATEST # ${initial_file}
+  displacements = 'disp_x disp_y disp_z'
+  [restart_mesh]
+    type = FileMeshGenerator
+    file = icestream_3d_sedimentlayer_steady_state_displacedmesh_out.e
+    use_for_exodus_restart = true
+  []
+  [surface_block]
+    type = LowerDBlockFromSidesetGenerator
+    input = restart_mesh
+    sidesets = 'surface'
+    new_block_name = 'surface'
+  []
 []
 
 [Functions]
@@ -60,23 +69,18 @@ inlet_mps = ${fparse
     symbol_names = 'inlet_mps'
     symbol_values = '${inlet_mps}'
   []
+  [initial_surface]
+    type = ParsedFunction
+    expression = 'z'
+  []
 []
 
-[Controls]
-  [disp_activated]
-    type = TimePeriod
-    start_time = 0
-    end_time = 1e6
-    disable_objects = 'BCs::no_disp_x
-                      BCs::no_disp_y
-                      BCs::no_disp_z
-                      Kernels::disp_x_source
-                      Kernels::disp_y_source
-                      Kernels::disp_z_source'
-    set_sync_times = true
-    execute_on = 'timestep_begin timestep_end'
+[UserObjects]
+  [column_surface]
+    type = ColumnSurfaceEvolution
+    surface_elevation = surface_elevation
+    ice_blocks = '1 255'
   []
-
 []
 
 [AuxVariables]
@@ -89,6 +93,12 @@ inlet_mps = ${fparse
   [vel_z]
     initial_from_file_var = vel_z
   []
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
 []
 
 [AuxKernels]
@@ -113,6 +123,12 @@ inlet_mps = ${fparse
     component = 'z'
     block = '1 0 255 254'
   []
+  [disp_z]
+    type = ColumnStretchAux
+    variable = disp_z
+    column_surface = column_surface
+    execute_on = 'initial timestep_end'
+  []
 []
 
 [Variables]
@@ -127,52 +143,28 @@ inlet_mps = ${fparse
     block = '1 0 255 254'
     initial_from_file_var = p
   []
-  [disp_x]
-    block = '1 0 255 254'
-    family = LAGRANGE
-    order = FIRST
-  []
-  [disp_y]
-    block = '1 0 255 254'
-    family = LAGRANGE
-    order = FIRST
-  []
-  [disp_z]
-    block = '1 0 255 254'
+  [surface_elevation]
     family = LAGRANGE
     order = FIRST
+    block = 'surface'
+    [InitialCondition]
+      type = FunctionIC
+      function = initial_surface
+    []
   []
 []
 
 [Kernels]
 
-  [disp_x_time]
-    type = TimeDerivative
-    variable = disp_x
-  []
-  [disp_y_time]
-    type = TimeDerivative
-    variable = disp_y
-  []
-  [disp_z_time]
-    type = TimeDerivative
-    variable = disp_z
-  []
-
-  [disp_x_source]
-    type = CoupledForce
-    variable = disp_x
-    v = vel_x
-  []
-  [disp_y_source]
-    type = CoupledForce
-    variable = disp_y
-    v = vel_y
-  []
-  [disp_z_source]
-    type = CoupledForce
-    variable = disp_z
-    v = vel_z
+  # ds/dt + u_h . grad(s) - w = a on the surface block
+  [surface_kinematic]
+    type = ADSurfaceKinematic
+    variable = surface_elevation
+    block = 'surface'
+    velocity_x = vel_x
+    velocity_y = vel_y
+    velocity_z = vel_z
+    accumulation = 0.
   []
 
   [mass_ice]
@@ -324,25 +316,6 @@ inlet_mps = ${fparse
   #  value = 1e5
   # []
 
-  [no_disp_x]
-    type = ADDirichletBC
-    variable = disp_x
-    boundary = 'left right bottom_sediment back left_sediment right_sediment front_sediment back_sediment'
-    value = 0
-  []
-  [no_disp_y]
-    type = ADDirichletBC
-    variable = disp_y
-    boundary = 'left right bottom_sediment back left_sediment right_sediment front_sediment back_sediment'
-    value = 0
-  []
-  [no_disp_z]
-    type = ADDirichletBC
-    variable = disp_z
-    boundary = 'left right bottom_sediment back front left_sediment right_sediment front_sediment back_sediment'
-    value = 0
-  []
-
   # no slip at the sediment base nor on the sides
   [no_slip_sides]
     type = ADVectorFunctionDirichletBC
@@ -489,7 +462,7 @@ inlet_mps = ${fparse
       petsc_options_value = 'full                            selfp                             300                1e-4      fgmres'
     []
     [u]
-      vars = 'vel_x vel_y vel_z'
+      vars = 'vel_x vel_y vel_z surface_elevation'
       petsc_options_iname = '-pc_type -pc_hypre_type -ksp_type -ksp_rtol -ksp_gmres_restart -ksp_pc_side'
       petsc_options_value = 'hypre    boomeramg      gmres    5e-1      300                 right'
     []
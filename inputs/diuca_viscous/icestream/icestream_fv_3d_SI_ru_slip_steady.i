@@ -93,6 +93,13 @@ initial_II_eps_min = 1e-07
 
 [Mesh]
 
+  # Keep every vertical element column (sediment and ice) on a single
+  # processor, printing the edge-cut and halo sizes against Metis
+  # [Partitioner]
+  #   type = ColumnPartitioner
+  #   report_statistics = true
+  # []
+
   [channel]
     type = FileMeshGenerator
     file = ../../meshes/mesh_icestream_sed.e
@@ -409,6 +416,53 @@ initial_II_eps_min = 1e-07
     function = 0
   []
 
+  # Without the extruded sediment layer, the equivalent basal friction
+  # is applied directly on the ice base (one block per velocity component).
+  # It only resists the tangential velocity, the flow through the bed is
+  # blocked separately (no_penetration)
+  # [basal_friction_x]
+  #   type = INSFVBasalFrictionBC
+  #   variable = vel_x
+  #   momentum_component = 'x'
+  #   boundary = 'bottom'
+  #   u = vel_x
+  #   v = vel_y
+  #   w = vel_z
+  #   sliding_law = GudmundssonRaymond
+  #   SlipperinessCoefficient = ${slipperiness_coefficient}
+  #   LayerThickness = ${sediment_layer_thickness}
+  # []
+  # [basal_friction_y]
+  #   type = INSFVBasalFrictionBC
+  #   variable = vel_y
+  #   momentum_component = 'y'
+  #   boundary = 'bottom'
+  #   u = vel_x
+  #   v = vel_y
+  #   w = vel_z
+  #   sliding_law = GudmundssonRaymond
+  #   SlipperinessCoefficient = ${slipperiness_coefficient}
+  #   LayerThickness = ${sediment_layer_thickness}
+  # []
+  # [basal_friction_z]
+  #   type = INSFVBasalFrictionBC
+  #   variable = vel_z
+  #   momentum_component = 'z'
+  #   boundary = 'bottom'
+  #   u = vel_x
+  #   v = vel_y
+  #   w = vel_z
+  #   sliding_law = GudmundssonRaymond
+  #   SlipperinessCoefficient = ${slipperiness_coefficient}
+  #   LayerThickness = ${sediment_layer_thickness}
+  # []
+  # [no_penetration]
+  #   type = INSFVNoSlipWallBC
+  #   variable = vel_z
+  #   boundary = 'bottom'
+  #   function = 0
+  # []
+
   # free slip at the surface
   [free_slip_x]
     type = INSFVNaturalFreeSlipBC
@@ -579,6 +633,32 @@ initial_II_eps_min = 1e-07
   []
 []
 
+# Refinement driven by the viscosity and strain rate jumps (shear margins,
+# front), instead of refining up front in the [Mesh] block
+# [Adaptivity]
+#   marker = jump_marker
+#   interval = 5
+#   max_h_level = 2
+#   [Indicators]
+#     [viscosity_jump]
+#       type = ViscosityJumpIndicator
+#       block = 'eleblock1 eleblock2'
+#       viscosity = mu_ice
+#       velocity_x = vel_x
+#       velocity_y = vel_y
+#       velocity_z = vel_z
+#     []
+#   []
+#   [Markers]
+#     [jump_marker]
+#       type = JumpThresholdMarker
+#       indicator = viscosity_jump
+#       refine = 0.2
+#       coarsen = 0.02
+#     []
+#   []
+# []
+
 [Executioner]
   type = Transient
   num_steps = 24
@@ -610,12 +690,27 @@ initial_II_eps_min = 1e-07
   line_search = none
 
   dt = '${_dt}'
+  # pseudo-transient continuation: dt grows with the steady residual
+  # reduction up to a pure Newton solve (replaces dt above, needs the
+  # steady_residual postprocessor below)
+  # [TimeStepper]
+  #   type = SERTimeStepper
+  #   dt = '${_dt}'
+  #   steady_residual = steady_residual
+  # []
   # steady_state_detection = true
   # steady_state_tolerance = 1e-100
   check_aux = true
  
 []
 
+# [Postprocessors]
+#   [steady_residual]
+#     type = Residual
+#     residual_type = INITIAL_BEFORE_PRESET
+#   []
+# []
+
 [Outputs]
   console = true
   [out]
@@ -0,0 +1,132 @@
+# ------------------------
+
+# First-order (Blatter-Pattyn) counterpart of iceslab_sia_fe.i: the
+# horizontal velocity is the only unknown, the pressure is hydrostatic
+# below the surface elevation
+
+# slope of the ice surface (in degrees)
+surface_slope = 10.
+
+length = 500.
+thickness = 100.
+
+# ------------------------
+
+[Mesh]
+  [base_mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = 0
+    xmax = '${length}'
+    ymin = 0
+    ymax = '${thickness}'
+    nx = 5
+    ny = 75
+    elem_type = QUAD8
+  []
+[]
+
+[Functions]
+  [surface_elevation]
+    type = ParsedFunction
+    expression = '${thickness} - x * tan(${surface_slope} / 180 * pi)'
+  []
+[]
+
+[AuxVariables]
+  [surface]
+    order = SECOND
+  []
+[]
+
+[AuxKernels]
+  [surface]
+    type = FunctionAux
+    variable = surface
+    function = surface_elevation
+    execute_on = 'initial'
+  []
+[]
+
+[Variables]
+  [vel_x]
+    order = SECOND
+    scaling = 1e6
+  []
+[]
+
+[Kernels]
+  [stress]
+    type = ADBlatterPattynStress
+    variable = vel_x
+    component = 'x'
+  []
+  [driving_stress]
+    type = ADBlatterPattynDrivingStress
+    variable = vel_x
+    component = 'x'
+    surface_elevation = surface
+  []
+[]
+
+[BCs]
+  [Periodic]
+    [up_down_velocity]
+      primary = left
+      secondary = right
+      translation = '${length} 0 0'
+      variable = 'vel_x'
+    []
+  []
+
+  [noslip]
+    type = ADDirichletBC
+    variable = vel_x
+    boundary = 'bottom'
+    value = 0.
+  []
+  # [friction]
+  #   type = ADBasalFrictionBC
+  #   variable = vel_x
+  #   boundary = 'bottom'
+  #   SlipperinessCoefficient = 1e-9
+  # []
+[]
+
+[Materials]
+  [ice]
+    type = ADIceMaterialSI_ru
+    velocity_x = "vel_x"
+    first_order = true
+    # upper viscosity bound, also used at the zero initial velocity
+    rampedup_viscosity = 1e16
+    output_properties = 'mu_ice sig_xx_dev sig_xy_dev'
+    outputs = "out"
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_factor_shift_type'
+    petsc_options_value = 'lu       NONZERO'
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+
+  nl_rel_tol = 1e-08
+  nl_abs_tol = 1e-05
+  nl_max_its = 100
+  line_search = none
+[]
+
+[Outputs]
+  console = true
+  [out]
+    type = Exodus
+  []
+[]
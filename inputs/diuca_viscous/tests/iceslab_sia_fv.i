@@ -154,6 +154,7 @@ initial_II_eps_min = 1e-07 # 1e-07
     mu = ${mu}
     momentum_component = 'x'
   []
+  # see iceslab_sia_fv_icestress.i for the Glen stresses of INSFVIceStress
   [u_pressure]
     type = INSFVMomentumPressure
     variable = vel_x
@@ -364,6 +365,21 @@ initial_II_eps_min = 1e-07 # 1e-07
   []
 []
 
+# memory and time of the transient run (iceslab_sia_fv_steady.i and
+# iceslab_sia_fv_segregated.i compare the monolithic and segregated solves
+# with identical steady physics)
+[Postprocessors]
+  [memory]
+    type = MemoryUsage
+    value_type = max_process
+  []
+  [solve_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  []
+[]
+
 [Executioner]
   type = Transient
   num_steps = 100
@@ -0,0 +1,289 @@
+# ------------------------
+
+# Segregated (SIMPLE) counterpart of iceslab_sia_fv_steady.i, with the same
+# physics (Glen stresses of INSFVIceStress, hydrostatic ocean pressure on the
+# front, fixed finite strain rate): the momentum components and the pressure
+# are solved as separate linear systems with AMG instead of a monolithic LU
+# factorization. Compare the memory and solve_time postprocessors of both
+# inputs, and keep their physics identical.
+
+# slope of the bottom boundary (in degrees)
+bed_slope = 10.
+
+# change coordinate system to add a slope
+gravity_x = '${fparse sin(bed_slope / 180 * pi) * 9.81 }'
+gravity_y = '${fparse - cos(bed_slope / 180 * pi) * 9.81}'
+
+#  geometry of the ice slab
+length = 10000.
+thickness = 100.
+
+# water depth at the front (m)
+water_depth = 50.
+
+# ------------------------
+
+# Numerical scheme parameters
+velocity_interp_method = 'rc'
+advected_interp_method = 'upwind'
+
+# Material properties
+rho = 'rho_ice'
+mu = 'mu_ice'
+
+# ------------------------
+
+[Problem]
+  nl_sys_names = 'u_system v_system pressure_system'
+  previous_nl_solution_required = true
+[]
+
+[Functions]
+  [pressure_pin]
+    type = ParsedFunction
+    expression = '917*9.81*sin(100-y)'
+  []
+  # elevation with respect to the sea level in the tilted frame
+  [ocean_elevation]
+    type = ParsedFunction
+    expression = '(y - water_depth) * cos(bed_slope / 180 * pi) - (x - length) * sin(bed_slope / 180 * pi)'
+    symbol_names = 'water_depth length bed_slope'
+    symbol_values = '${water_depth} ${length} ${bed_slope}'
+  []
+[]
+
+[GlobalParams]
+  rhie_chow_user_object = 'rc'
+[]
+
+[UserObjects]
+  [rc]
+    type = INSFVRhieChowInterpolatorSegregated
+    u = vel_x
+    v = vel_y
+    pressure = pressure
+  []
+[]
+
+[Mesh]
+  [base_mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = 0
+    xmax = '${length}'
+    ymin = 0
+    ymax = '${thickness}'
+    nx = 50
+    ny = 100
+    elem_type = QUAD9
+  []
+[]
+
+[ICs]
+  [pressure_ic]
+    type = FunctionIC
+    variable = 'pressure'
+    function = pressure_pin
+  []
+[]
+
+[Variables]
+  [vel_x]
+    type = INSFVVelocityVariable
+    two_term_boundary_expansion = true
+    initial_condition = 1e-7
+    solver_sys = u_system
+  []
+  [vel_y]
+    type = INSFVVelocityVariable
+    two_term_boundary_expansion = true
+    solver_sys = v_system
+  []
+  [pressure]
+    type = INSFVPressureVariable
+    two_term_boundary_expansion = true
+    solver_sys = pressure_system
+  []
+[]
+
+[FVKernels]
+  [mass]
+    type = INSFVMassAdvection
+    variable = pressure
+    advected_interp_method = ${advected_interp_method}
+    velocity_interp_method = ${velocity_interp_method}
+    rho = ${rho}
+  []
+
+  [u_advection]
+    type = INSFVMomentumAdvection
+    variable = vel_x
+    advected_interp_method = ${advected_interp_method}
+    velocity_interp_method = ${velocity_interp_method}
+    rho = ${rho}
+    momentum_component = 'x'
+  []
+  [u_viscosity]
+    type = INSFVIceStress
+    variable = vel_x
+    sig_x = sig_x
+    mu = ${mu}
+    momentum_component = 'x'
+  []
+  [u_pressure]
+    type = INSFVMomentumPressure
+    variable = vel_x
+    pressure = pressure
+    momentum_component = 'x'
+  []
+  [u_gravity]
+    type = INSFVMomentumGravity
+    variable = vel_x
+    momentum_component = 'x'
+    rho = ${rho}
+    gravity = '${gravity_x} ${gravity_y} 0.'
+  []
+
+  [v_advection]
+    type = INSFVMomentumAdvection
+    variable = vel_y
+    advected_interp_method = ${advected_interp_method}
+    velocity_interp_method = ${velocity_interp_method}
+    rho = ${rho}
+    momentum_component = 'y'
+  []
+  [v_viscosity]
+    type = INSFVIceStress
+    variable = vel_y
+    sig_y = sig_y
+    mu = ${mu}
+    momentum_component = 'y'
+  []
+  [v_pressure]
+    type = INSFVMomentumPressure
+    variable = vel_y
+    pressure = pressure
+    momentum_component = 'y'
+  []
+  [v_gravity]
+    type = INSFVMomentumGravity
+    variable = vel_y
+    momentum_component = 'y'
+    rho = ${rho}
+    gravity = '${gravity_x} ${gravity_y} 0.'
+  []
+[]
+
+[FVBCs]
+  [noslip_x]
+    type = INSFVNoSlipWallBC
+    variable = vel_x
+    boundary = 'bottom'
+    function = 0.
+  []
+  [noslip_y]
+    type = INSFVNoSlipWallBC
+    variable = vel_y
+    boundary = 'bottom'
+    function = 0
+  []
+
+  [freeslip_x]
+    type = INSFVNaturalFreeSlipBC
+    variable = vel_x
+    boundary = 'top'
+    momentum_component = 'x'
+  []
+  [freeslip_y]
+    type = INSFVNaturalFreeSlipBC
+    variable = vel_y
+    boundary = 'top'
+    momentum_component = 'y'
+  []
+
+  [ocean_x]
+    type = INSFVHydrostaticPressureBC
+    variable = vel_x
+    boundary = 'right'
+    momentum_component = 'x'
+    elevation = ocean_elevation
+  []
+  [ocean_y]
+    type = INSFVHydrostaticPressureBC
+    variable = vel_y
+    boundary = 'right'
+    momentum_component = 'y'
+    elevation = ocean_elevation
+  []
+
+  [outlet_p]
+    type = INSFVOutletPressureBC
+    variable = pressure
+    boundary = 'right'
+    functor = pressure_pin
+  []
+  [inlet_p]
+    type = INSFVOutletPressureBC
+    variable = pressure
+    boundary = 'left'
+    functor = pressure_pin
+  []
+[]
+
+[FunctorMaterials]
+  [ice]
+    type = FVIceMaterialSI
+    velocity_x = "vel_x"
+    velocity_y = "vel_y"
+    pressure = "pressure"
+    # bounds the viscosity of the initial state at rest, there is no
+    # continuation ramp in the steady solves (same value in
+    # iceslab_sia_fv_steady.i)
+    II_eps_min = 1e-17
+    output_properties = 'mu_ice rho_ice eps_xx eps_yy sig_xx sig_yy eps_xy sig_xy'
+    outputs = "out"
+  []
+[]
+
+[Postprocessors]
+  [memory]
+    type = MemoryUsage
+    value_type = max_process
+  []
+  [solve_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  []
+[]
+
+[Executioner]
+  type = SIMPLENonlinearAssembly
+  rhie_chow_user_object = 'rc'
+  momentum_systems = 'u_system v_system'
+  pressure_system = 'pressure_system'
+
+  momentum_equation_relaxation = 0.8
+  pressure_variable_relaxation = 0.3
+  num_iterations = 2000
+  pressure_absolute_tolerance = 1e-8
+  momentum_absolute_tolerance = 1e-8
+
+  momentum_petsc_options_iname = '-pc_type -pc_hypre_type'
+  momentum_petsc_options_value = 'hypre    boomeramg'
+  pressure_petsc_options_iname = '-pc_type -pc_hypre_type'
+  pressure_petsc_options_value = 'hypre    boomeramg'
+  momentum_l_abs_tol = 1e-13
+  pressure_l_abs_tol = 1e-13
+  momentum_l_tol = 0
+  pressure_l_tol = 0
+  momentum_l_max_its = 30
+  pressure_l_max_its = 30
+[]
+
+[Outputs]
+  console = true
+  [out]
+    type = Exodus
+  []
+[]
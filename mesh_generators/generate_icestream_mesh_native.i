@@ -0,0 +1,42 @@
+# Same ice stream geometry as generate_icestream_mesh.i, with its sediment
+# layer, built by a single mesh generator. The mesh is stored in mesh_cache/
+# under a hash of the geometric parameters and read from there by later runs.
+# With --distributed-mesh, each processor only builds its slab of columns.
+
+[Mesh]
+  [icestream]
+    type = IcestreamMeshGenerator
+    length = 25000.
+    width = 10000.
+    channel_depth = -800.
+    channel_width_spread = 1200.
+    side_elevation = -100.
+    peak_position = 5000.
+    surface_slope = 0.032
+    front_elevation = 100.
+    sediment_thickness = 50.
+    nb_elements_alongflow = 50
+    nb_elements_acrossflow = 30
+    nb_elements_depth = 7
+    nb_elements_sediment = 1
+    cache_directory = mesh_cache
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Postprocessors]
+  [volume]
+    type = VolumePostprocessor
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Write a gridded forcing field f(x, y, t) in the binary format read by GriddedForcingData.
+
+File layout (native byte order):
+  char     magic[8] = "DIUCAGRD"
+  uint64   nx, ny, nt
+  float64  x[nx], y[ny], t[nt]   (strictly increasing, possibly non-uniform)
+  float64  f[nt][ny][nx]
+
+From Python:
+  write_gridded_forcing("smb.grd", x, y, t, f)   # f indexed as f[k][j][i] (or a numpy array)
+
+From the command line, sampling an expression of x, y and t on the grid:
+  write_gridded_forcing.py smb.grd --x 0 1 3 --y 0 2 --t 0 10 --expression "x + y * t"
+"""
+
+import argparse
+import math
+import struct
+import sys
+from array import array
+
+
+def write_gridded_forcing(filename, x, y, t, f):
+    """Write the axes x, y, t and the values f[k][j][i] to filename."""
+    x, y, t = (array("d", axis) for axis in (x, y, t))
+    for name, axis, n_min in (("x", x, 2), ("y", y, 2), ("t", t, 1)):
+        if len(axis) < n_min:
+            raise ValueError(f"the {name} axis needs at least {n_min} values")
+        if any(b <= a for a, b in zip(axis, axis[1:])):
+            raise ValueError(f"the {name} axis is not strictly increasing")
+
+    values = array("d")
+    if len(f) != len(t):
+        raise ValueError(f"{len(f)} time slices, {len(t)} expected")
+    for k, time_slice in enumerate(f):
+        if len(time_slice) != len(y) or any(len(row) != len(x) for row in time_slice):
+            raise ValueError(f"time slice {k} is not a {len(y)} x {len(x)} (ny x nx) grid")
+        for row in time_slice:
+            values.extend(float(v) for v in row)
+
+    with open(filename, "wb") as file:
+        file.write(b"DIUCAGRD")
+        file.write(struct.pack("=3Q", len(x), len(y), len(t)))
+        for data in (x, y, t, values):
+            data.tofile(file)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("file", help="output file")
+    parser.add_argument("--x", type=float, nargs="+", required=True, help="x axis")
+    parser.add_argument("--y", type=float, nargs="+", required=True, help="y axis")
+    parser.add_argument("--t", type=float, nargs="+", default=[0.0], help="t axis (default: 0)")
+    parser.add_argument(
+        "--expression", required=True, help="expression of x, y and t (math module available)"
+    )
+    args = parser.parse_args()
+
+    namespace = {name: getattr(math, name) for name in dir(math) if not name.startswith("_")}
+    f = [
+        [[eval(args.expression, namespace, {"x": xi, "y": yj, "t": tk}) for xi in args.x]
+         for yj in args.y]
+        for tk in args.t
+    ]
+
+    try:
+        write_gridded_forcing(args.file, args.x, args.y, args.t, f)
+    except ValueError as error:
+        sys.exit(f"write_gridded_forcing.py: {error}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,87 @@
+# Solves the patch of ice_stress_divergence.i with a body force, once with the
+# hand-coded material and kernels (here) and once with their AD counterparts
+# (ad_comparison_sub.i), and fails unless both solutions agree. The body force
+# makes the solution non-trivial, so that a residual error shared by the
+# hand-coded residual and its Jacobian changes the solution.
+
+!include ice_stress_divergence.i
+
+[Kernels]
+  [u_body_force]
+    type = BodyForce
+    variable = vel_x
+    value = 1500.
+  []
+[]
+
+[AuxVariables]
+  [vel_x_ad]
+  []
+  [vel_y_ad]
+  []
+[]
+
+[MultiApps]
+  [ad]
+    type = FullSolveMultiApp
+    input_files = ad_comparison_sub.i
+    execute_on = initial
+  []
+[]
+
+[Transfers]
+  [vel_x_ad]
+    type = MultiAppCopyTransfer
+    from_multi_app = ad
+    source_variable = vel_x
+    variable = vel_x_ad
+    execute_on = initial
+  []
+  [vel_y_ad]
+    type = MultiAppCopyTransfer
+    from_multi_app = ad
+    source_variable = vel_y
+    variable = vel_y_ad
+    execute_on = initial
+  []
+[]
+
+[Postprocessors]
+  [vel_x_norm]
+    type = ElementL2Norm
+    variable = vel_x
+  []
+  [vel_y_norm]
+    type = ElementL2Norm
+    variable = vel_y
+  []
+  [vel_x_difference]
+    type = ElementL2Difference
+    variable = vel_x
+    other_variable = vel_x_ad
+  []
+  [vel_y_difference]
+    type = ElementL2Difference
+    variable = vel_y
+    other_variable = vel_y_ad
+  []
+  [relative_difference]
+    type = ParsedPostprocessor
+    expression = '(vel_x_difference + vel_y_difference) / (vel_x_norm + vel_y_norm)'
+    pp_names = 'vel_x_difference vel_y_difference vel_x_norm vel_y_norm'
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'relative_difference > 1e-6'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The hand-coded and AD ice stress solutions differ'
+  []
+[]
+
+[Executioner]
+  nl_rel_tol = 1e-10
+[]
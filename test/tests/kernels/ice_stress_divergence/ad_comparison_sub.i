@@ -0,0 +1,15 @@
+# AD side of ad_comparison.i
+
+!include ad_ice_stress_divergence.i
+
+[Kernels]
+  [u_body_force]
+    type = BodyForce
+    variable = vel_x
+    value = 1500.
+  []
+[]
+
+[Executioner]
+  nl_rel_tol = 1e-10
+[]
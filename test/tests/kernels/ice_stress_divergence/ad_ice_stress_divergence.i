@@ -0,0 +1,19 @@
+# Same problem as ice_stress_divergence.i with the AD material and kernels
+
+!include ice_stress_divergence.i
+
+[Kernels]
+  [u_viscous]
+    type := ADIceStressDivergence
+  []
+  [v_viscous]
+    type := ADIceStressDivergence
+  []
+[]
+
+[Materials]
+  [ice]
+    type := ADIceMaterialSI_ru
+    pressure = 0
+  []
+[]
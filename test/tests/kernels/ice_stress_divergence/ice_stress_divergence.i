@@ -0,0 +1,89 @@
+# Viscous ice stress with Glen's flow law on a small 2D patch with a
+# non-uniform velocity field, so that the viscosity depends on the
+# solution everywhere. Used to check the hand-coded Jacobian of
+# IceStressDivergence/IceMaterialSI and, with ad=true, the AD Jacobian of
+# ADIceStressDivergence/ADIceMaterialSI_ru on the same problem.
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+    xmax = 100.
+    ymax = 100.
+  []
+[]
+
+[Variables]
+  [vel_x]
+  []
+  [vel_y]
+  []
+[]
+
+[ICs]
+  [vel_x]
+    type = FunctionIC
+    variable = vel_x
+    function = '1e-5 * (1 + 0.01 * x + 1e-4 * x * y)'
+  []
+  [vel_y]
+    type = FunctionIC
+    variable = vel_y
+    function = '1e-5 * (0.5 - 0.02 * y + 1e-4 * x * x)'
+  []
+[]
+
+[Kernels]
+  [u_viscous]
+    type = IceStressDivergence
+    variable = vel_x
+    component = x
+    velocity_x = vel_x
+    velocity_y = vel_y
+  []
+  [v_viscous]
+    type = IceStressDivergence
+    variable = vel_y
+    component = y
+    velocity_x = vel_x
+    velocity_y = vel_y
+  []
+[]
+
+[BCs]
+  [inlet_x]
+    type = DirichletBC
+    variable = vel_x
+    boundary = left
+    value = 1e-5
+  []
+  [inlet_y]
+    type = DirichletBC
+    variable = vel_y
+    boundary = left
+    value = 0
+  []
+[]
+
+[Materials]
+  [ice]
+    type = IceMaterialSI
+    velocity_x = vel_x
+    velocity_y = vel_y
+    rampedup_viscosity = 1e15
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+[]
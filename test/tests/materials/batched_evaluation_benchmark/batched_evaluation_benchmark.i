@@ -0,0 +1,136 @@
+# Throughput of ADIceMaterialSI_ru with and without the element-batched
+# evaluation (see tests, HEX8 and HEX27 variants): a 3D viscous ice block
+# solved with PJFNK, so that most material evaluations are residual-only.
+# The average time of a residual evaluation is printed at the end of the run.
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 12
+    ny = 12
+    nz = 6
+    xmax = 1000.
+    ymax = 1000.
+    zmax = 100.
+    elem_type = HEX8
+  []
+[]
+
+[Variables]
+  [vel_x]
+  []
+  [vel_y]
+  []
+  [vel_z]
+  []
+[]
+
+[ICs]
+  [vel_x]
+    type = FunctionIC
+    variable = vel_x
+    function = '1e-5 * (1 + 1e-3 * x + 1e-6 * x * y)'
+  []
+  [vel_y]
+    type = FunctionIC
+    variable = vel_y
+    function = '1e-5 * (0.5 - 2e-3 * y + 1e-6 * x * x)'
+  []
+[]
+
+[Kernels]
+  [u_viscous]
+    type = ADIceStressDivergence
+    variable = vel_x
+    component = x
+    velocity_x = vel_x
+    velocity_y = vel_y
+    velocity_z = vel_z
+  []
+  [v_viscous]
+    type = ADIceStressDivergence
+    variable = vel_y
+    component = y
+    velocity_x = vel_x
+    velocity_y = vel_y
+    velocity_z = vel_z
+  []
+  [w_viscous]
+    type = ADIceStressDivergence
+    variable = vel_z
+    component = z
+    velocity_x = vel_x
+    velocity_y = vel_y
+    velocity_z = vel_z
+  []
+[]
+
+[BCs]
+  [inlet_x]
+    type = DirichletBC
+    variable = vel_x
+    boundary = left
+    value = 1e-5
+  []
+  [inlet_y]
+    type = DirichletBC
+    variable = vel_y
+    boundary = left
+    value = 0
+  []
+  [bed_z]
+    type = DirichletBC
+    variable = vel_z
+    boundary = back
+    value = 0
+  []
+[]
+
+[Materials]
+  [ice]
+    type = ADIceMaterialSI_ru
+    velocity_x = vel_x
+    velocity_y = vel_y
+    velocity_z = vel_z
+    pressure = 0
+    rampedup_viscosity = 1e15
+    batched_evaluation = false
+  []
+[]
+
+[Postprocessors]
+  [residual_evaluations]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeResidualInternal'
+    data_type = CALLS
+    execute_on = final
+  []
+  [residual_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeResidualInternal'
+    data_type = TOTAL_AVG
+    execute_on = final
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'bjacobi'
+[]
+
+[Outputs]
+  [console]
+    type = Console
+    execute_postprocessors_on = final
+  []
+[]
@@ -0,0 +1,102 @@
+# Two time steps of the viscous ice patch of ice_stress_divergence.i with a
+# time-dependent inflow, in the Picard / Newton hybrid mode. The switch
+# tolerance is loose enough for Newton to start as soon as the residual
+# postprocessor is evaluated again: every time step, including the second
+# one, must nevertheless start with Picard iterations, the postprocessor
+# still holding the converged residual of the previous step.
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+    xmax = 100.
+    ymax = 100.
+  []
+[]
+
+[Variables]
+  [vel_x]
+  []
+  [vel_y]
+  []
+[]
+
+[ICs]
+  [vel_x]
+    type = FunctionIC
+    variable = vel_x
+    function = '1e-5 * (1 + 0.01 * x + 1e-4 * x * y)'
+  []
+  [vel_y]
+    type = FunctionIC
+    variable = vel_y
+    function = '1e-5 * (0.5 - 0.02 * y + 1e-4 * x * x)'
+  []
+[]
+
+[Kernels]
+  [u_viscous]
+    type = ADIceStressDivergence
+    variable = vel_x
+    component = x
+    velocity_x = vel_x
+    velocity_y = vel_y
+  []
+  [v_viscous]
+    type = ADIceStressDivergence
+    variable = vel_y
+    component = y
+    velocity_x = vel_x
+    velocity_y = vel_y
+  []
+[]
+
+[BCs]
+  [inlet_x]
+    type = FunctionDirichletBC
+    variable = vel_x
+    boundary = left
+    function = '1e-5 * (1 + t)'
+  []
+  [inlet_y]
+    type = DirichletBC
+    variable = vel_y
+    boundary = left
+    value = 0
+  []
+[]
+
+[Materials]
+  [ice]
+    type = ADIceMaterialSI_ru
+    velocity_x = vel_x
+    velocity_y = vel_y
+    pressure = 0
+    rampedup_viscosity = 1e15
+    picard_residual = nl_residual
+    newton_switch_tolerance = 1e100
+  []
+[]
+
+[Postprocessors]
+  [nl_residual]
+    type = Residual
+    execute_on = 'linear nonlinear'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 2
+  dt = 1
+[]
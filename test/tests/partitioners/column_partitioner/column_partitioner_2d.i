@@ -0,0 +1,31 @@
+# 2D counterpart of column_partitioner_3d.i: the columns are vertical along y
+
+[Mesh]
+  parallel_type = replicated
+  [slab]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmax = 3000
+    nx = 9
+    ny = 2
+  []
+  [trough]
+    type = ParsedNodeTransformGenerator
+    input = slab
+    x_function = 'x'
+    y_function = '0.4 * abs(x - 1500) + 50 * y'
+    z_function = 'z'
+  []
+  [Partitioner]
+    type = ColumnPartitioner
+    report_statistics = true
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
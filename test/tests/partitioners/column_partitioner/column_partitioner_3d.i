@@ -0,0 +1,36 @@
+# Partitions a thin extruded slab lying on a V-shaped bed (slope 0.4 across
+# the flow, 333 m wide and 25 m thick layers, as on the icestream trough
+# flanks): the downhill side faces sit below the bottom faces, which must not
+# be mistaken for them. No column may be split over several partitions.
+
+[Mesh]
+  parallel_type = replicated
+  [slab]
+    type = GeneratedMeshGenerator
+    dim = 3
+    xmax = 3000
+    nx = 9
+    ymax = 3000
+    ny = 9
+    nz = 2
+  []
+  [trough]
+    type = ParsedNodeTransformGenerator
+    input = slab
+    x_function = 'x'
+    y_function = 'y'
+    z_function = '0.4 * abs(y - 1500) + 50 * z'
+  []
+  [Partitioner]
+    type = ColumnPartitioner
+    report_statistics = true
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
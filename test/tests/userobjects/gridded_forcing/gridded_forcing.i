@@ -0,0 +1,79 @@
+# Interpolates the grid written by write_gridded_forcing.py (see tests), sampled
+# from f = 1 + 2 x + 3 y + x y + 0.5 t on x = {0, 1, 3}, y = {0, 2}, t = {0, 10}.
+# The interpolation reproduces f exactly inside of the grid and time range and
+# holds the boundary values outside of it. The mesh nodes sample both x cells
+# and all sides of the grid; the last time step (t = 12) is past the last slice.
+
+[Mesh]
+  [square]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = -1
+    xmax = 4
+    nx = 10
+    ymin = -1
+    ymax = 3
+    ny = 8
+  []
+[]
+
+[UserObjects]
+  [grid]
+    type = GriddedForcingData
+    file = grid.grd
+  []
+  [check]
+    type = Terminator
+    expression = 'max_error > 1e-10'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The gridded data was not interpolated exactly'
+  []
+[]
+
+[Functions]
+  [forcing]
+    type = GriddedForcingFunction
+    gridded_data = grid
+  []
+[]
+
+[AuxVariables]
+  [f]
+  []
+  [error]
+  []
+[]
+
+[AuxKernels]
+  [f]
+    type = FunctionAux
+    variable = f
+    function = forcing
+  []
+  [error]
+    type = ParsedAux
+    variable = error
+    coupled_variables = 'f'
+    expression = 'abs(f - (1 + 2 * min(max(x, 0), 3) + 3 * min(max(y, 0), 2)
+                           + min(max(x, 0), 3) * min(max(y, 0), 2) + 0.5 * min(t, 10)))'
+    use_xyzt = true
+  []
+[]
+
+[Postprocessors]
+  [max_error]
+    type = NodalExtremeValue
+    variable = error
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  dt = 4
+  num_steps = 3
+[]
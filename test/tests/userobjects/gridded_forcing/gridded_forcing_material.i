@@ -0,0 +1,85 @@
+# Drives the sediment viscosity of ADSedimentMaterialSI with the time-dependent grid
+# of gridded_forcing.i, f = 1 + 2 x + 3 y + x y + 0.5 t on x = {0, 1, 3}, y = {0, 2},
+# t = {0, 10}. The material passes its element to the data, so the values go through
+# the element cell cache, and the time dimension is interpolated at every step while
+# the spatial fields stay cached. The grid lines are element edges, so f is bilinear
+# on each element and its element average (mu_sediment projected on a constant
+# monomial) is the exact value at the element centroid.
+
+[Mesh]
+  [square]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = -1
+    xmax = 4
+    nx = 10
+    ymin = -1
+    ymax = 3
+    ny = 8
+  []
+[]
+
+[UserObjects]
+  [grid]
+    type = GriddedForcingData
+    file = grid.grd
+  []
+  [check]
+    type = Terminator
+    expression = 'max_error > 1e-10'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The time-dependent gridded sediment viscosity was not interpolated exactly'
+  []
+[]
+
+[Materials]
+  [sediment]
+    type = ADSedimentMaterialSI
+    base_viscosity_data = grid
+  []
+[]
+
+[AuxVariables]
+  [mu]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [error]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [mu]
+    type = ADMaterialRealAux
+    variable = mu
+    property = mu_sediment
+  []
+  [error]
+    type = ParsedAux
+    variable = error
+    coupled_variables = 'mu'
+    expression = 'abs(mu - (1 + 2 * min(max(x, 0), 3) + 3 * min(max(y, 0), 2)
+                            + min(max(x, 0), 3) * min(max(y, 0), 2) + 0.5 * min(t, 10)))'
+    use_xyzt = true
+  []
+[]
+
+[Postprocessors]
+  [max_error]
+    type = ElementExtremeValue
+    variable = error
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  dt = 4
+  num_steps = 3
+[]
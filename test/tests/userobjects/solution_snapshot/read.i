@@ -0,0 +1,123 @@
+# Reads the snapshots of write.i on the same mesh: every node and element
+# centroid coincides with a snapshot point, so the values must be restored
+# exactly (no inverse distance weighting)
+
+[Mesh]
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+  [distort]
+    type = ParsedNodeTransformGenerator
+    input = cube
+    x_function = 'x'
+    y_function = 'y'
+    z_function = 'z * (1 + 0.5 * x * y)'
+  []
+[]
+
+[UserObjects]
+  [nodal_snapshot]
+    type = SolutionSnapshot
+    file = nodal.snp
+  []
+  [elemental_snapshot]
+    type = SolutionSnapshot
+    file = elemental.snp
+  []
+  [check]
+    type = Terminator
+    expression = 'max_error > 1e-10'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The snapshot values were not restored exactly'
+  []
+[]
+
+[Functions]
+  [exact]
+    type = ParsedFunction
+    expression = 'x + 2 * y + 3 * z + x * y * z'
+  []
+  [u_snapshot]
+    type = SolutionSnapshotFunction
+    snapshot = nodal_snapshot
+    field = u
+  []
+  [v_snapshot]
+    type = SolutionSnapshotFunction
+    snapshot = elemental_snapshot
+    field = v
+  []
+[]
+
+[AuxVariables]
+  [u]
+    [InitialCondition]
+      type = FunctionIC
+      function = u_snapshot
+    []
+  []
+  [v]
+    type = MooseVariableFVReal
+    [InitialCondition]
+      type = FVFunctionIC
+      function = v_snapshot
+    []
+  []
+  [v_exact]
+    type = MooseVariableFVReal
+    [InitialCondition]
+      type = FVFunctionIC
+      function = exact
+    []
+  []
+  [u_error]
+  []
+  [v_error]
+    type = MooseVariableFVReal
+  []
+[]
+
+[AuxKernels]
+  [u_error]
+    type = ParsedAux
+    variable = u_error
+    coupled_variables = 'u'
+    expression = 'abs(u - (x + 2 * y + 3 * z + x * y * z))'
+    use_xyzt = true
+  []
+  [v_error]
+    type = ParsedAux
+    variable = v_error
+    coupled_variables = 'v v_exact'
+    expression = 'abs(v - v_exact)'
+  []
+[]
+
+[Postprocessors]
+  [u_max_error]
+    type = NodalExtremeValue
+    variable = u_error
+  []
+  [v_max_error]
+    type = ElementExtremeValue
+    variable = v_error
+  []
+  [max_error]
+    type = ParsedPostprocessor
+    expression = 'max(u_max_error, v_max_error)'
+    pp_names = 'u_max_error v_max_error'
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
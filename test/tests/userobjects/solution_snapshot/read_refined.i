@@ -0,0 +1,131 @@
+# Reads the snapshots of a linear field written by write.i on the undistorted cube
+# (see tests) onto the uniformly refined cube. The original nodes keep their values
+# exactly, the new nodes and all the element centroids go through the inverse
+# distance weighting of the surrounding bins. It is first order only: it does not
+# reproduce linear fields, and it is one-sided on the boundary. The tolerances
+# bound the errors of this mesh (about 0.62 at the nodes and 1.31 at the
+# centroids, for a field ranging from 0 to 6).
+
+[Mesh]
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+  uniform_refine = 1
+[]
+
+[UserObjects]
+  [nodal_snapshot]
+    type = SolutionSnapshot
+    file = nodal_linear.snp
+  []
+  [elemental_snapshot]
+    type = SolutionSnapshot
+    file = elemental_linear.snp
+  []
+  [check]
+    type = Terminator
+    expression = 'u_max_error > 0.65 | v_max_error > 1.35 | u_coincident_error > 1e-10'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The snapshot values were not projected onto the refined mesh'
+  []
+[]
+
+[Functions]
+  [exact]
+    type = ParsedFunction
+    expression = 'x + 2 * y + 3 * z'
+  []
+  [u_snapshot]
+    type = SolutionSnapshotFunction
+    snapshot = nodal_snapshot
+    field = u
+  []
+  [v_snapshot]
+    type = SolutionSnapshotFunction
+    snapshot = elemental_snapshot
+    field = v
+  []
+[]
+
+[AuxVariables]
+  [u]
+    [InitialCondition]
+      type = FunctionIC
+      function = u_snapshot
+    []
+  []
+  [v]
+    type = MooseVariableFVReal
+    [InitialCondition]
+      type = FVFunctionIC
+      function = v_snapshot
+    []
+  []
+  [v_exact]
+    type = MooseVariableFVReal
+    [InitialCondition]
+      type = FVFunctionIC
+      function = exact
+    []
+  []
+  [u_error]
+  []
+  [u_coincident_error]
+  []
+  [v_error]
+    type = MooseVariableFVReal
+  []
+[]
+
+[AuxKernels]
+  [u_error]
+    type = ParsedAux
+    variable = u_error
+    coupled_variables = 'u'
+    expression = 'abs(u - (x + 2 * y + 3 * z))'
+    use_xyzt = true
+  []
+  # error on the nodes of the original mesh only, zero on the nodes added by the refinement
+  [u_coincident_error]
+    type = ParsedAux
+    variable = u_coincident_error
+    coupled_variables = 'u'
+    expression = 'if(abs(4 * x - round(4 * x)) + abs(4 * y - round(4 * y))
+                     + abs(4 * z - round(4 * z)) < 1e-8, abs(u - (x + 2 * y + 3 * z)), 0)'
+    use_xyzt = true
+  []
+  [v_error]
+    type = ParsedAux
+    variable = v_error
+    coupled_variables = 'v v_exact'
+    expression = 'abs(v - v_exact)'
+  []
+[]
+
+[Postprocessors]
+  [u_max_error]
+    type = NodalExtremeValue
+    variable = u_error
+  []
+  [u_coincident_error]
+    type = NodalExtremeValue
+    variable = u_coincident_error
+  []
+  [v_max_error]
+    type = ElementExtremeValue
+    variable = v_error
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
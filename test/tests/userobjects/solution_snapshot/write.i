@@ -0,0 +1,65 @@
+# Writes a nodal and a finite volume field of a distorted hexahedral mesh
+# as solution snapshots, read back by read.i
+
+[Mesh]
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+  # non-affine elements, whose true centroids differ from their vertex averages
+  [distort]
+    type = ParsedNodeTransformGenerator
+    input = cube
+    x_function = 'x'
+    y_function = 'y'
+    z_function = 'z * (1 + 0.5 * x * y)'
+  []
+[]
+
+[Functions]
+  [exact]
+    type = ParsedFunction
+    expression = 'x + 2 * y + 3 * z + x * y * z'
+  []
+[]
+
+[AuxVariables]
+  [u]
+    [InitialCondition]
+      type = FunctionIC
+      function = exact
+    []
+  []
+  [v]
+    type = MooseVariableFVReal
+    [InitialCondition]
+      type = FVFunctionIC
+      function = exact
+    []
+  []
+[]
+
+[UserObjects]
+  [nodal_snapshot]
+    type = SolutionSnapshotWriter
+    file = nodal.snp
+    variables = 'u'
+  []
+  [elemental_snapshot]
+    type = SolutionSnapshotWriter
+    file = elemental.snp
+    variables = 'v'
+    location = elements
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
@@ -0,0 +1,77 @@
+# Response spectra of two acceleration histories sampled on irregular time steps,
+# regularized to a dt that no history time is a multiple of. The batch mode
+# computes the spectra from the complete histories at the end of the run, the
+# incremental mode (see tests) advances the oscillators at every time step;
+# both must write the same spectra.
+
+[Mesh]
+  [line]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 2
+  []
+[]
+
+[Functions]
+  # nonzero at t = 0, where the oscillators start
+  [acceleration]
+    type = ParsedFunction
+    expression = 'cos(2 * pi * t) * (1 + x) + 0.5 * sin(7 * t)'
+  []
+[]
+
+[AuxVariables]
+  [accel]
+  []
+[]
+
+[AuxKernels]
+  [accel]
+    type = FunctionAux
+    variable = accel
+    function = acceleration
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[VectorPostprocessors]
+  [history]
+    type = ResponseHistoryBuilder
+    variables = 'accel'
+    nodes = '0 2'
+  []
+  [spectra]
+    type = ResponseSpectraCalculator
+    vectorpostprocessor = history
+    regularize_dt = 0.0137
+    start_frequency = 0.1
+    end_frequency = 10
+    num_frequencies = 11
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0
+  end_time = 1.9961
+  [TimeStepper]
+    type = TimeSequenceStepper
+    time_sequence = '0.0526 0.0936 0.1221 0.1486 0.1856 0.2358 0.2899 0.3348 0.3662 0.3918
+                     0.425 0.472 0.5263 0.5749 0.6098 0.6357 0.6656 0.7087 0.7622 0.8137
+                     0.8525 0.8799 0.9073 0.9464 0.998 1.0514 1.0943 1.1241 1.15 1.1852
+                     1.2339 1.2883 1.335 1.3679 1.3936 1.4251 1.4703 1.5244 1.5745 1.6112
+                     1.6376 1.6663 1.7075 1.7603 1.8128 1.8535 1.8819 1.9085 1.9457 1.9961'
+  []
+[]
+
+[Outputs]
+  [out]
+    type = CSV
+    execute_on = final
+    show = spectra
+  []
+[]